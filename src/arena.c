@@ -0,0 +1,71 @@
+///////////////////////////|
+//|File: arena.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Bump allocator over one aligned block. Everything a game owns is carved
+ * from its arena when the game is created, so play itself never touches
+ * the heap and the whole game is released with one free.
+ */
+
+//----------------------------------------------------------------
+
+// SDL2 //
+#include <SDL2/SDL.h>
+
+// Header Files //
+#include "arena.h"
+
+
+// Create arena with size bytes //
+Arena *Arena_Create(size_t size) {
+
+	Arena *arena = SDL_malloc(sizeof(Arena));
+	if (!arena) {
+		SDL_SetError("Failed to allocate memory for arena.");
+		return NULL;
+	}
+	*arena = (Arena) {
+		.base = SDL_SIMDAlloc(size ? size : 1),
+		.size = size
+	};
+	if (!arena->base) {
+		SDL_free(arena);
+		SDL_SetError("Failed to allocate %lu bytes for arena.", (unsigned long)size);
+		return NULL;
+	}
+	return arena;
+}
+
+
+// Destroy arena and everything allocated from it //
+void Arena_Destroy(Arena *arena) {
+	if (!arena) return;
+	SDL_SIMDFree(arena->base);
+	SDL_free(arena);
+}
+
+
+// Hands out size bytes aligned to ARENA_ALIGN, NULL when the arena is full //
+void *Arena_Alloc(Arena *arena, size_t size) {
+
+	const size_t footprint = ARENA_FOOTPRINT(size);
+	if (footprint > arena->size - arena->used) {
+		SDL_SetError("Arena out of memory, %lu of %lu bytes used.", (unsigned long)arena->used, (unsigned long)arena->size);
+		return NULL;
+	}
+	void *memory = arena->base + arena->used;
+	arena->used += footprint;
+	return memory;
+}
+
+
+// Forgets every allocation, the memory is reused by the next ones //
+void Arena_Reset(Arena *arena) {
+	arena->used = 0;
+}
@@ -0,0 +1,39 @@
+///////////////////////////|
+//|File: arena.h
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+//----------------------------------------------------------------
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+#include <SDL2/SDL_stdinc.h>
+
+// Every allocation starts on this boundary, enough for AVX loads //
+#define ARENA_ALIGN 64
+
+// Space reserved for one allocation of size bytes, for sizing an arena up front //
+#define ARENA_FOOTPRINT(size) (((size) + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN)
+
+// One block carved up front to back, freed all at once //
+typedef struct {
+	Uint8 *base;
+	size_t size;		// bytes in the block
+	size_t used;		// bytes handed out so far
+} Arena;
+
+Arena *Arena_Create(size_t size);
+
+void Arena_Destroy(Arena *arena);
+
+void *Arena_Alloc(Arena *arena, size_t size);
+
+void Arena_Reset(Arena *arena);
+
+#endif
@@ -0,0 +1,167 @@
+///////////////////////////|
+//|File: assets.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Loads images and sounds from the packed asset archive when one is open,
+ * otherwise from the loose files. The archive is memory mapped and its
+ * pixel and sample data is handed to SDL without copying or decoding.
+ */
+
+//----------------------------------------------------------------
+
+// Includes //
+#include <stdbool.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define ASSETS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// SDL2 //
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+
+// Header Files //
+#include "assets.h"
+
+// Open archive //
+static Uint8 *archive;
+static size_t archive_size;
+static bool archive_mapped;
+static const Asset_Entry *entries;
+static Uint32 entry_count;
+
+
+// Maps or reads the whole archive into memory //
+static bool load_archive(const char *path) {
+
+#ifdef ASSETS_MMAP
+	int fd = open(path, O_RDONLY);
+	if (fd >= 0) {
+		struct stat st;
+		void *data = MAP_FAILED;
+		if (fstat(fd, &st) == 0 && st.st_size > 0) {
+			data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		}
+		close(fd);
+		if (data != MAP_FAILED) {
+			archive = data;
+			archive_size = st.st_size;
+			archive_mapped = true;
+			return true;
+		}
+	}
+#endif
+	archive = SDL_LoadFile(path, &archive_size);
+	archive_mapped = false;
+	return archive != NULL;
+}
+
+
+// Opens the asset archive, returns false and keeps using loose files if it is missing or invalid //
+bool Assets_Open(const char *path) {
+
+	Assets_Close();
+	if (!load_archive(path)) return false;
+	const Assets_Header *header = (const Assets_Header *)archive;
+	if (
+		archive_size < sizeof(Assets_Header) ||
+		SDL_memcmp(header->magic, ASSETS_MAGIC, 4) != 0 ||
+		header->version != ASSETS_VERSION ||
+		header->count > (archive_size - sizeof(Assets_Header)) / sizeof(Asset_Entry)
+	) {
+		Assets_Close();
+		SDL_SetError("%s is not a version %d asset archive.", path, ASSETS_VERSION);
+		return false;
+	}
+	entries = (const Asset_Entry *)(header + 1);
+	entry_count = header->count;
+	for (Uint32 i = 0; i < entry_count; ++i) {
+		if (entries[i].offset > archive_size || entries[i].size > archive_size - entries[i].offset) {
+			Assets_Close();
+			SDL_SetError("%s is truncated.", path);
+			return false;
+		}
+	}
+	return true;
+}
+
+
+// Releases the archive, every chunk loaded from it must be freed first //
+void Assets_Close(void) {
+
+	if (!archive) return;
+#ifdef ASSETS_MMAP
+	if (archive_mapped) munmap(archive, archive_size);
+	else SDL_free(archive);
+#else
+	SDL_free(archive);
+#endif
+	archive = NULL;
+	archive_size = 0;
+	entries = NULL;
+	entry_count = 0;
+}
+
+
+// Finds an archive entry by the path it was packed from //
+static const Asset_Entry *find(const char *path, Uint32 type) {
+
+	for (Uint32 i = 0; i < entry_count; ++i) {
+		if (entries[i].type == type && SDL_strncmp(entries[i].name, path, ASSET_NAME_MAX) == 0) return &entries[i];
+	}
+	return NULL;
+}
+
+
+// Archive entry for an image whose pixels fit its data, NULL when it is not packed //
+static const Asset_Entry *find_image(const char *path) {
+	const Asset_Entry *entry = find(path, ASSET_IMAGE);
+	return entry && (Uint64)entry->pitch * entry->height <= entry->size ? entry : NULL;
+}
+
+
+// Whether an image loads from the archive, its color key is then already transparent //
+bool Assets_HasImage(const char *path) {
+	return find_image(path) != NULL;
+}
+
+
+// Loads an image, pixels from the archive are used in place //
+SDL_Surface *Assets_LoadBMP(const char *path) {
+
+	const Asset_Entry *entry = find_image(path);
+	if (entry) {
+		// SDL only reads these pixels, so the read-only mapping is safe //
+		return SDL_CreateRGBSurfaceWithFormatFrom(
+			archive + entry->offset, entry->width, entry->height, 32, entry->pitch, entry->format
+		);
+	}
+	return SDL_LoadBMP(path);
+}
+
+
+// Loads a sound, samples from the archive are played in place when they match the mixer //
+Mix_Chunk *Assets_LoadWAV(const char *path) {
+
+	const Asset_Entry *entry = find(path, ASSET_SOUND);
+	int frequency, channels;
+	Uint16 format;
+	if (
+		entry &&
+		Mix_QuerySpec(&frequency, &format, &channels) &&
+		(Uint32)frequency == entry->frequency && format == entry->format && (Uint32)channels == entry->channels
+	) {
+		return Mix_QuickLoad_RAW(archive + entry->offset, entry->size);
+	}
+	return Mix_LoadWAV(path);
+}
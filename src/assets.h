@@ -0,0 +1,65 @@
+///////////////////////////|
+//|File: assets.h
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+//----------------------------------------------------------------
+
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include <stdbool.h>
+
+// Archive layout //
+#define ASSETS_FILE "assets.pak"
+#define ASSETS_MAGIC "SDPK"
+#define ASSETS_VERSION 2		// 2: images have the 0x00FF00 color key baked into alpha
+#define ASSETS_ALIGN 64			// every entry's data starts on this boundary
+#define ASSET_NAME_MAX 48
+
+// Pixel data is stored ready for texture upload //
+#define ASSETS_PIXELFORMAT SDL_PIXELFORMAT_ARGB8888
+
+// Mixer format, sounds are stored already converted to it //
+#define AUDIO_FREQUENCY 48000
+#define AUDIO_FORMAT AUDIO_S16SYS
+#define AUDIO_CHANNELS 2
+
+// Entry types //
+#define ASSET_IMAGE 1
+#define ASSET_SOUND 2
+
+// Archive header //
+typedef struct {
+	char magic[4];		// ASSETS_MAGIC
+	Uint32 version;		// ASSETS_VERSION
+	Uint32 count;		// number of entries following the header
+	Uint32 reserved;
+} Assets_Header;
+
+// One packed asset //
+typedef struct {
+	char name[ASSET_NAME_MAX];	// path the asset was packed from
+	Uint32 type;				// ASSET_IMAGE or ASSET_SOUND
+	Uint32 offset, size;		// where the data is in the archive
+	Uint32 format;				// SDL pixel format or SDL audio format
+	Uint32 width, height;		// image size in pixels
+	Uint32 pitch;				// bytes per image row
+	Uint32 frequency;			// sound sample rate
+	Uint32 channels;			// sound channel count
+} Asset_Entry;
+
+bool Assets_Open(const char *path);
+
+void Assets_Close(void);
+
+bool Assets_HasImage(const char *path);
+
+SDL_Surface *Assets_LoadBMP(const char *path);
+
+struct Mix_Chunk *Assets_LoadWAV(const char *path);
+
+#endif
@@ -0,0 +1,195 @@
+///////////////////////////|
+//|File: asteroids.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Structure-of-arrays asteroid storage and the movement kernel.
+ * The kernel has AVX2, SSE2 and plain C versions, picked once at runtime.
+ * Asteroids are pooled entities, the arrays only ever hold live ones.
+ */
+
+//----------------------------------------------------------------
+
+// SDL2 //
+#include <SDL2/SDL.h>
+
+// Header Files //
+#include "arena.h"
+#include "entity.h"
+#include "asteroids.h"
+#include "shared.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+#define ASTEROIDS_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ASTEROIDS_AVX2
+#include <immintrin.h>
+#endif
+
+// Arrays are padded to this many floats so each one starts on a SIMD boundary //
+#define FIELD_ALIGN 16
+
+// Moves asteroids [start, count) and lists the ones that fell off screen //
+typedef size_t (*Update_Kernel)(Asteroid_Field *field, size_t start, float delta_t, float accel, Uint32 *respawn);
+
+static Update_Kernel update_kernel;
+
+
+// Plain C kernel, also finishes the tail of the vector kernels //
+static size_t update_scalar(Asteroid_Field *field, size_t start, float delta_t, float accel, Uint32 *respawn) {
+
+	size_t respawns = 0;
+	for (size_t i = start; i < field->count; ++i) {
+		field->prev_y[i] = field->y[i];
+		field->y[i] += field->velocity[i] * delta_t;
+		field->velocity[i] += accel * delta_t;
+		if (field->y[i] > HEIGHT) respawn[respawns++] = i;
+	}
+	return respawns;
+}
+
+
+#ifdef ASTEROIDS_SSE2
+// Four asteroids per step //
+static size_t update_sse2(Asteroid_Field *field, size_t start, float delta_t, float accel, Uint32 *respawn) {
+
+	const __m128 dt = _mm_set1_ps(delta_t);
+	const __m128 dv = _mm_set1_ps(accel * delta_t);
+	const __m128 bottom = _mm_set1_ps(HEIGHT);
+	size_t respawns = 0, i = start;
+	for (; i + 4 <= field->count; i += 4) {
+		__m128 y = _mm_load_ps(field->y + i);
+		__m128 v = _mm_load_ps(field->velocity + i);
+		_mm_store_ps(field->prev_y + i, y);
+		y = _mm_add_ps(y, _mm_mul_ps(v, dt));
+		_mm_store_ps(field->y + i, y);
+		_mm_store_ps(field->velocity + i, _mm_add_ps(v, dv));
+		int mask = _mm_movemask_ps(_mm_cmpgt_ps(y, bottom));
+		for (Uint32 lane = 0; mask; ++lane, mask >>= 1) {
+			if (mask & 1) respawn[respawns++] = i + lane;
+		}
+	}
+	return respawns + update_scalar(field, i, delta_t, accel, respawn + respawns);
+}
+#endif
+
+
+#ifdef ASTEROIDS_AVX2
+// Eight asteroids per step //
+__attribute__((target("avx2")))
+static size_t update_avx2(Asteroid_Field *field, size_t start, float delta_t, float accel, Uint32 *respawn) {
+
+	const __m256 dt = _mm256_set1_ps(delta_t);
+	const __m256 dv = _mm256_set1_ps(accel * delta_t);
+	const __m256 bottom = _mm256_set1_ps(HEIGHT);
+	size_t respawns = 0, i = start;
+	for (; i + 8 <= field->count; i += 8) {
+		__m256 y = _mm256_load_ps(field->y + i);
+		__m256 v = _mm256_load_ps(field->velocity + i);
+		_mm256_store_ps(field->prev_y + i, y);
+		y = _mm256_add_ps(y, _mm256_mul_ps(v, dt));
+		_mm256_store_ps(field->y + i, y);
+		_mm256_store_ps(field->velocity + i, _mm256_add_ps(v, dv));
+		int mask = _mm256_movemask_ps(_mm256_cmp_ps(y, bottom, _CMP_GT_OQ));
+		for (Uint32 lane = 0; mask; ++lane, mask >>= 1) {
+			if (mask & 1) respawn[respawns++] = i + lane;
+		}
+	}
+	// avoid the AVX to SSE transition penalty in the scalar tail //
+	_mm256_zeroupper();
+	return respawns + update_scalar(field, i, delta_t, accel, respawn + respawns);
+}
+#endif
+
+
+// Picks the widest kernel this CPU supports //
+static Update_Kernel pick_kernel(void) {
+
+#ifdef ASTEROIDS_AVX2
+	if (SDL_HasAVX2()) return update_avx2;
+#endif
+#ifdef ASTEROIDS_SSE2
+	if (SDL_HasSSE2()) return update_sse2;
+#endif
+	return update_scalar;
+}
+
+
+// Arena space Asteroid_Field_Create takes //
+size_t Asteroid_Field_Footprint(size_t capacity) {
+	const size_t stride = (capacity + FIELD_ALIGN - 1) / FIELD_ALIGN * FIELD_ALIGN;
+	return ARENA_FOOTPRINT(sizeof(Asteroid_Field)) +
+		ARENA_FOOTPRINT(stride * (5 * sizeof(float) + sizeof(Uint32))) +
+		Entity_Pool_Footprint(capacity);
+}
+
+
+// Create an empty asteroid field with room for capacity asteroids //
+Asteroid_Field *Asteroid_Field_Create(Arena *arena, size_t capacity) {
+
+	const size_t stride = (capacity + FIELD_ALIGN - 1) / FIELD_ALIGN * FIELD_ALIGN;
+	Asteroid_Field *field = Arena_Alloc(arena, sizeof(Asteroid_Field));
+	float *block = Arena_Alloc(arena, stride * (5 * sizeof(float) + sizeof(Uint32)));
+	if (!field || !block) return NULL;
+	*field = (Asteroid_Field) {
+		.x = block,
+		.y = block + stride,
+		.prev_y = block + stride * 2,
+		.velocity = block + stride * 3,
+		.size = block + stride * 4,
+		.respawn = (Uint32 *)(block + stride * 5)
+	};
+	if (!Entity_Pool_Init(&field->entities, arena, capacity)) return NULL;
+	if (!update_kernel) update_kernel = pick_kernel();
+	return field;
+}
+
+
+// Despawns every asteroid //
+void Asteroid_Field_Clear(Asteroid_Field *field) {
+	Entity_Pool_Clear(&field->entities);
+	field->count = 0;
+}
+
+
+// Adds an asteroid at index count - 1, ENTITY_NONE when the field is full //
+Entity Asteroid_Field_Spawn(Asteroid_Field *field, float x, float y, float velocity, float size) {
+
+	const Entity rock = Entity_Spawn(&field->entities);
+	if (rock.slot == ENTITY_INVALID) return rock;
+	const size_t i = field->count++;
+	field->x[i] = x;
+	field->y[i] = y;
+	field->prev_y[i] = y;
+	field->velocity[i] = velocity;
+	field->size[i] = size;
+	return rock;
+}
+
+
+// Removes an asteroid, the last one moves into its index, which is returned //
+Uint32 Asteroid_Field_Despawn(Asteroid_Field *field, Entity rock) {
+
+	const Uint32 hole = Entity_Despawn(&field->entities, rock);
+	if (hole == ENTITY_INVALID) return hole;
+	const size_t last = --field->count;
+	field->x[hole] = field->x[last];
+	field->y[hole] = field->y[last];
+	field->prev_y[hole] = field->prev_y[last];
+	field->velocity[hole] = field->velocity[last];
+	field->size[hole] = field->size[last];
+	return hole;
+}
+
+
+// Moves every asteroid, returns how many were listed in field->respawn //
+size_t Asteroid_Field_Update(Asteroid_Field *field, float delta_t, float accel) {
+	return update_kernel(field, 0, delta_t, accel, field->respawn);
+}
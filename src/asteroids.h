@@ -0,0 +1,42 @@
+///////////////////////////|
+//|File: asteroids.h
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+//----------------------------------------------------------------
+
+#ifndef ASTEROIDS_H
+#define ASTEROIDS_H
+
+#include <stddef.h>
+
+#include "arena.h"
+#include "entity.h"
+
+// Asteroid field, one array per member, live asteroids are packed at the front //
+typedef struct {
+	Entity_Pool entities;	// handle of each asteroid
+	size_t count;		// number of live asteroids, mirrors entities.count
+	float *x, *y;		// x and y position of each asteroid
+	float *prev_y;		// y position before the last step, for interpolation
+	float *velocity;	// Speed which each asteroid moves
+	float *size;		// Size of each asteroid
+	Uint32 *respawn;	// asteroids that fell off screen during the last update
+} Asteroid_Field;
+
+size_t Asteroid_Field_Footprint(size_t capacity);
+
+Asteroid_Field *Asteroid_Field_Create(Arena *arena, size_t capacity);
+
+void Asteroid_Field_Clear(Asteroid_Field *field);
+
+Entity Asteroid_Field_Spawn(Asteroid_Field *field, float x, float y, float velocity, float size);
+
+Uint32 Asteroid_Field_Despawn(Asteroid_Field *field, Entity rock);
+
+size_t Asteroid_Field_Update(Asteroid_Field *field, float delta_t, float accel);
+
+#endif
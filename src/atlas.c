@@ -0,0 +1,143 @@
+///////////////////////////|
+//|File: atlas.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Packs every image into one texture at startup so sprites, text
+ * and the background are all drawn without switching textures.
+ */
+
+//----------------------------------------------------------------
+
+// SDL2 //
+#include <SDL2/SDL.h>
+
+// Header Files //
+#include "atlas.h"
+
+// Size of the white block reserved for solid quads //
+#define WHITE_SIZE 2
+
+
+// Finds room for a w by h image, starting a new shelf when the current one is full //
+static bool place(Atlas *atlas, int w, int h, SDL_Rect *region) {
+
+	if (atlas->shelf_x + w > atlas->width) {
+		atlas->shelf_x = 0;
+		atlas->shelf_y += atlas->shelf_h + ATLAS_PADDING;
+		atlas->shelf_h = 0;
+	}
+	if (w > atlas->width || atlas->shelf_y + h > atlas->height) {
+		SDL_SetError("No room for a %dx%d image in the %dx%d atlas.", w, h, atlas->width, atlas->height);
+		return false;
+	}
+	*region = (SDL_Rect) {atlas->shelf_x, atlas->shelf_y, w, h};
+	atlas->shelf_x += w + ATLAS_PADDING;
+	if (h > atlas->shelf_h) atlas->shelf_h = h;
+	return true;
+}
+
+
+// Create an empty atlas texture //
+Atlas *Atlas_Create(SDL_Renderer *renderer, int width, int height) {
+
+	Atlas *atlas = SDL_malloc(sizeof(Atlas));
+	if (!atlas) {
+		SDL_SetError("Failed to allocate memory for atlas.");
+		return NULL;
+	}
+	*atlas = (Atlas) {
+		.texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, width, height),
+		.width = width,
+		.height = height
+	};
+	if (!atlas->texture) {
+		SDL_free(atlas);
+		return NULL;
+	}
+	SDL_SetTextureBlendMode(atlas->texture, SDL_BLENDMODE_BLEND);
+
+	// solid quads sample the middle of a white block so they share the texture //
+	Uint32 white[WHITE_SIZE * WHITE_SIZE];
+	for (int i = 0; i < WHITE_SIZE * WHITE_SIZE; ++i) white[i] = 0xFFFFFFFF;
+	SDL_Rect region;
+	if (!place(atlas, WHITE_SIZE, WHITE_SIZE, &region) ||
+		SDL_UpdateTexture(atlas->texture, &region, white, WHITE_SIZE * sizeof(Uint32)) < 0) {
+		Atlas_Destroy(atlas);
+		return NULL;
+	}
+	atlas->white = (SDL_FRect) {
+		.x = (region.x + WHITE_SIZE / 2.0f) / width,
+		.y = (region.y + WHITE_SIZE / 2.0f) / height
+	};
+	return atlas;
+}
+
+
+// Destroy atlas //
+void Atlas_Destroy(Atlas *atlas) {
+	if (!atlas) return;
+	SDL_DestroyTexture(atlas->texture);
+	SDL_free(atlas->pixels);
+	SDL_free(atlas);
+}
+
+
+// Keeps a copy of every image added from now on, call it before adding any //
+bool Atlas_KeepPixels(Atlas *atlas) {
+
+	if (atlas->pixels) return true;
+	atlas->pixels = SDL_calloc((size_t)atlas->width * atlas->height, sizeof(Uint32));
+	if (!atlas->pixels) {
+		SDL_SetError("Failed to allocate memory for atlas pixels.");
+		return false;
+	}
+	const int x = atlas->white.x * atlas->width - WHITE_SIZE / 2, y = atlas->white.y * atlas->height - WHITE_SIZE / 2;
+	for (int row = y; row < y + WHITE_SIZE; ++row) {
+		for (int col = x; col < x + WHITE_SIZE; ++col) atlas->pixels[row * atlas->width + col] = 0xFFFFFFFF;
+	}
+	return true;
+}
+
+
+// Copies a surface into the atlas, a color key on the surface becomes transparency //
+bool Atlas_Add(Atlas *atlas, SDL_Surface *surface, SDL_Rect *region) {
+
+	if (!surface) return false;
+	if (!place(atlas, surface->w, surface->h, region)) return false;
+
+	// surfaces already in the atlas format without a key, like packed images, are uploaded as they are //
+	Uint32 key;
+	const bool keyed = SDL_GetColorKey(surface, &key) == 0;
+	const bool ready = !keyed && surface->format->format == SDL_PIXELFORMAT_ARGB8888;
+	SDL_Surface *pixels = ready ? surface : SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+	if (!pixels) return false;
+
+	if (keyed) {
+		Uint8 r, g, b;
+		SDL_GetRGB(key, surface->format, &r, &g, &b);
+		const Uint32 rgb = (Uint32)r << 16 | (Uint32)g << 8 | b;
+		for (int y = 0; y < pixels->h; ++y) {
+			Uint32 *row = (Uint32 *)((Uint8 *)pixels->pixels + y * pixels->pitch);
+			for (int x = 0; x < pixels->w; ++x) {
+				if ((row[x] & 0x00FFFFFF) == rgb) row[x] = 0;
+			}
+		}
+	}
+	const int result = SDL_UpdateTexture(atlas->texture, region, pixels->pixels, pixels->pitch);
+	if (atlas->pixels) {
+		for (int y = 0; y < pixels->h; ++y) {
+			SDL_memcpy(
+				atlas->pixels + (region->y + y) * atlas->width + region->x,
+				(Uint8 *)pixels->pixels + y * pixels->pitch, pixels->w * sizeof(Uint32)
+			);
+		}
+	}
+	if (pixels != surface) SDL_FreeSurface(pixels);
+	return result == 0;
+}
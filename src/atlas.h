@@ -0,0 +1,37 @@
+///////////////////////////|
+//|File: atlas.h
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+//----------------------------------------------------------------
+
+#ifndef ATLAS_H
+#define ATLAS_H
+
+#include <stdbool.h>
+
+// Pixels left empty around every image so filtering never bleeds between them //
+#define ATLAS_PADDING 1
+
+// One texture holding every image, packed in shelves from the top-left //
+typedef struct {
+	SDL_Texture *texture;	// shared by every tilesheet in the atlas
+	int width, height;		// texture size in pixels
+	int shelf_x, shelf_y;	// where the next image goes
+	int shelf_h;			// tallest image on the current shelf
+	SDL_FRect white;		// uv of an opaque white texel, for solid quads
+	Uint32 *pixels;			// copy of the texture for drawing on the CPU, NULL unless kept
+} Atlas;
+
+Atlas *Atlas_Create(SDL_Renderer *renderer, int width, int height);
+
+void Atlas_Destroy(Atlas *atlas);
+
+bool Atlas_KeepPixels(Atlas *atlas);
+
+bool Atlas_Add(Atlas *atlas, SDL_Surface *surface, SDL_Rect *region);
+
+#endif
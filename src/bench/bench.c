@@ -0,0 +1,439 @@
+///////////////////////////|
+//|File: bench.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Microbenchmarks for Space Dodge's hot paths. Runs under the dummy video
+ * driver with the software renderer, so results do not depend on a GPU.
+ * Each benchmark is warmed up, then timed over several repetitions and the
+ * median ns/op is reported. Results are written as JSON and compared with
+ * a stored baseline, any benchmark slower than the tolerance fails the run,
+ * and so does a baseline that is missing. make bench records one first.
+ *
+ * Usage: sdbench [--json FILE] [--baseline FILE] [--tolerance PCT] [--reps N] [--filter TEXT]
+ */
+
+//----------------------------------------------------------------
+
+// Includes //
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+// SDL2 //
+#include <SDL2/SDL.h>
+
+// Header Files //
+#include "atlas.h"
+#include "tilesheet.h"
+#include "font.h"
+#include "ship.h"
+#include "game.h"
+#include "quad.h"
+#include "assets.h"
+#include "simulation.h"
+#include "softfb.h"
+#include "shared.h"
+
+// Defines //
+#define BENCH_REPS 11			// timed repetitions, the median is reported
+#define BENCH_WARMUP 3			// untimed repetitions before them
+#define BENCH_REP_MS 20			// ops per repetition are doubled until one takes this long
+#define BENCH_TOLERANCE 15		// percent slower than the baseline that counts as a regression
+#define BENCH_MAX 32			// benchmarks a baseline file can hold
+#define BENCH_NAME 48
+#define BENCH_SEED 1
+#define BENCH_SETTLE 600		// steps run before timing, so the rocks are spread over the screen
+#define ATLAS_WIDTH 256
+#define ATLAS_HEIGHT 512
+
+// One benchmark, run performs ops operations //
+typedef struct {
+	const char *name;
+	void (*run)(Uint64 ops);
+} Benchmark;
+
+// Timing of one benchmark //
+typedef struct {
+	char name[BENCH_NAME];
+	double ns_per_op;		// median of the repetitions
+	double min, max;
+	Uint64 ops;				// operations per repetition
+} Result;
+
+// Renderer and assets shared by the benchmarks //
+static SDL_Window *window;
+static SDL_Renderer *renderer;
+static Atlas *atlas;
+static TileSheet *ship;
+static Font *font;
+static Game *small, *stress;
+static Quad_Batch *batch;
+static Soft_Frame *frame;
+
+// Results are folded in here so the compiler cannot drop the work //
+static volatile Uint64 sink;
+
+
+// TileSheet_getTileRect over every tile //
+static void bench_tile_rect(Uint64 ops) {
+
+	Uint64 sum = 0;
+	for (Uint64 i = 0; i < ops; ++i) {
+		const SDL_Rect rect = TileSheet_getTileRect(ship, i % (ship->sheet_width * ship->sheet_height));
+		sum += rect.x + rect.y;
+	}
+	sink += sum;
+}
+
+
+// TileSheet_getPixel across one tile //
+static void bench_get_pixel(Uint64 ops) {
+
+	Uint64 sum = 0;
+	for (Uint64 i = 0; i < ops; ++i) {
+		sum += TileSheet_getPixel(ship, 0, i % SHIP_WIDTH, i / SHIP_WIDTH % SHIP_HEIGHT);
+	}
+	sink += sum;
+}
+
+
+// Font_renderText of a HUD sized string, flushed so the rasterizing is timed //
+static void bench_render_text(Uint64 ops) {
+
+	const SDL_Point point = {0, 0};
+	for (Uint64 i = 0; i < ops; ++i) {
+		sink += Font_renderText(font, renderer, &point, "SCORE: 1234567").w;
+		SDL_RenderFlush(renderer);
+	}
+}
+
+
+// One physics step //
+static void physics(Game *game, Uint64 ops) {
+
+	const float delta_t = 1.0f / DEFAULT_TICK_RATE;
+	for (Uint64 i = 0; i < ops; ++i) Game_Physics(game, delta_t);
+	sink += game->rocks->count;
+}
+
+
+static void bench_physics(Uint64 ops) {
+	physics(small, ops);
+}
+
+
+static void bench_physics_stress(Uint64 ops) {
+	physics(stress, ops);
+}
+
+
+// One ship collision query against the settled field //
+static void collision(Game *game, Uint64 ops) {
+
+	Uint64 hits = 0;
+	for (Uint64 i = 0; i < ops; ++i) {
+		game->ship_position = i % (WIDTH - SHIP_WIDTH);
+		hits += Game_Collision(game, NULL);
+	}
+	sink += hits;
+}
+
+
+static void bench_collision(Uint64 ops) {
+	collision(small, ops);
+}
+
+
+static void bench_collision_stress(Uint64 ops) {
+	collision(stress, ops);
+}
+
+
+// Asteroids drawn the way the game loop draws them, on the renderer or composed on the CPU and uploaded //
+static void draw_rock(Game *game, Uint64 ops, bool soft) {
+
+	const Asteroid_Field *rocks = game->rocks;
+	const Snapshot snapshot = {
+		.rock_count = rocks->count,
+		.rock_x = rocks->x,
+		.rock_y = rocks->y,
+		.rock_prev_y = rocks->prev_y,
+		.rock_size = rocks->size
+	};
+	for (Uint64 i = 0; i < ops; ++i) {
+		Quad_Batch_Clear(batch);
+		Snapshot_Draw(&snapshot, batch, &atlas->white, 0.5f);
+		if (soft) {
+			Soft_Frame_DrawBatch(frame, batch);
+			sink += Soft_Frame_Present(frame, renderer);
+		} else {
+			sink += Quad_Batch_Render(batch, renderer, atlas->texture);
+		}
+		SDL_RenderFlush(renderer);
+	}
+}
+
+
+static void bench_draw_rock(Uint64 ops) {
+	draw_rock(small, ops, false);
+}
+
+
+static void bench_draw_rock_stress(Uint64 ops) {
+	draw_rock(stress, ops, false);
+}
+
+
+static void bench_softfb_draw_rock(Uint64 ops) {
+	draw_rock(small, ops, true);
+}
+
+
+static void bench_softfb_draw_rock_stress(Uint64 ops) {
+	draw_rock(stress, ops, true);
+}
+
+
+// Every benchmark, in report order //
+static const Benchmark benchmarks[] = {
+	{"tilesheet_get_tile_rect", bench_tile_rect},
+	{"tilesheet_get_pixel", bench_get_pixel},
+	{"font_render_text", bench_render_text},
+	{"physics", bench_physics},
+	{"physics_stress", bench_physics_stress},
+	{"collision", bench_collision},
+	{"collision_stress", bench_collision_stress},
+	{"draw_rock", bench_draw_rock},
+	{"draw_rock_stress", bench_draw_rock_stress},
+	{"softfb_draw_rock", bench_softfb_draw_rock},
+	{"softfb_draw_rock_stress", bench_softfb_draw_rock_stress}
+};
+
+
+// Seconds taken by one repetition //
+static double time_run(const Benchmark *bench, Uint64 ops) {
+
+	const Uint64 start = SDL_GetPerformanceCounter();
+	bench->run(ops);
+	return (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+}
+
+
+// Orders repetition times for the median //
+static int compare_double(const void *a, const void *b) {
+	const double x = *(const double *)a, y = *(const double *)b;
+	return (x > y) - (x < y);
+}
+
+
+// Calibrates, warms up and times one benchmark //
+static Result measure(const Benchmark *bench, int reps) {
+
+	Uint64 ops = 1;
+	while (time_run(bench, ops) * 1000 < BENCH_REP_MS && ops < ((Uint64)1 << 40)) ops *= 2;
+	for (int i = 0; i < BENCH_WARMUP; ++i) time_run(bench, ops);
+
+	double ns[BENCH_REPS * 8];
+	for (int i = 0; i < reps; ++i) ns[i] = time_run(bench, ops) * 1e9 / ops;
+	qsort(ns, reps, sizeof(double), compare_double);
+
+	Result result = {.ns_per_op = ns[reps / 2], .min = ns[0], .max = ns[reps - 1], .ops = ops};
+	SDL_strlcpy(result.name, bench->name, sizeof(result.name));
+	return result;
+}
+
+
+// Writes the results, one benchmark per line so the baseline reader stays simple //
+static bool write_json(const char *path, const Result *results, int count, int reps) {
+
+	FILE *file = fopen(path, "w");
+	if (!file) {
+		SDL_SetError("Could not open %s for writing.", path);
+		return false;
+	}
+	fprintf(file, "{\n\t\"renderer\": \"software\",\n\t\"reps\": %d,\n\t\"benchmarks\": [\n", reps);
+	for (int i = 0; i < count; ++i) {
+		const Result *result = &results[i];
+		fprintf(file, "\t\t{\"name\": \"%s\", \"ns_per_op\": %.3f, \"min\": %.3f, \"max\": %.3f, \"ops\": %llu}%s\n",
+			result->name, result->ns_per_op, result->min, result->max,
+			(unsigned long long)result->ops, i + 1 < count ? "," : "");
+	}
+	fprintf(file, "\t]\n}\n");
+	if (fclose(file) != 0) {
+		SDL_SetError("Could not write %s.", path);
+		return false;
+	}
+	return true;
+}
+
+
+// Reads names and ns/op back from a file written by write_json, returns the count or -1 //
+static int read_baseline(const char *path, Result *baseline) {
+
+	FILE *file = fopen(path, "r");
+	if (!file) return -1;
+	char line[256];
+	int count = 0;
+	while (count < BENCH_MAX && fgets(line, sizeof(line), file)) {
+		Result *result = &baseline[count];
+		const char *name = strstr(line, "\"name\": \"");
+		const char *ns = strstr(line, "\"ns_per_op\": ");
+		if (!name || !ns) continue;
+		name += strlen("\"name\": \"");
+		const size_t length = strcspn(name, "\"");
+		if (length >= sizeof(result->name)) continue;
+		SDL_memcpy(result->name, name, length);
+		result->name[length] = '\0';
+		result->ns_per_op = SDL_atof(ns + strlen("\"ns_per_op\": "));
+		++count;
+	}
+	fclose(file);
+	return count;
+}
+
+
+// Opens the renderer and loads everything the benchmarks use //
+static bool setup(void) {
+
+	// always the dummy driver and software rasterizer, results must not depend on the display //
+	SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+	SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+	if (SDL_Init(SDL_INIT_VIDEO) < 0) return false;
+	window = SDL_CreateWindow("Space Dodge Bench", 0, 0, WIDTH * SCALE, HEIGHT * SCALE, 0);
+	if (!window) return false;
+	renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_SOFTWARE | SDL_RENDERER_TARGETTEXTURE);
+	if (!renderer) return false;
+	SDL_RenderSetLogicalSize(renderer, WIDTH, HEIGHT);
+
+	Assets_Open(ASSETS_FILE);
+	atlas = Atlas_Create(renderer, ATLAS_WIDTH, ATLAS_HEIGHT);
+	if (!atlas || !Atlas_KeepPixels(atlas)) return false;
+	ship = TileSheet_createInAtlas("Images/ship.bmp", atlas, SHIP_WIDTH, SHIP_HEIGHT, TILESHEET_CREATEMASK);
+	font = Font_createInAtlas("Images/font.bmp", atlas, 1);
+	small = Game_Create(TOTAL_ROCKS);
+	stress = Game_Create(STRESS_ROCKS);
+	batch = Quad_Batch_Create(STRESS_ROCKS);
+	frame = Soft_Frame_Create(renderer, atlas, WIDTH, HEIGHT);
+	if (!ship || !font || !small || !stress || !batch || !frame) return false;
+
+	// both fields start settled and never end on a hit //
+	Game *games[] = {small, stress};
+	for (int i = 0; i < 2; ++i) {
+		Game_SetShipMask(games[i], TileSheet_getTileMask(ship, 0));
+		Game_Init(games[i], BENCH_SEED);
+		games[i]->invulnerable = true;
+		for (int tick = 0; tick < BENCH_SETTLE; ++tick) Game_Step(games[i], 1.0f / DEFAULT_TICK_RATE);
+	}
+	return true;
+}
+
+
+// Frees whatever setup made //
+static void teardown(void) {
+
+	Soft_Frame_Destroy(frame);
+	Quad_Batch_Destroy(batch);
+	Game_Destroy(stress);
+	Game_Destroy(small);
+	if (font) Font_destroy(font);
+	if (ship) TileSheet_destroy(ship);
+	if (atlas) Atlas_Destroy(atlas);
+	if (renderer) SDL_DestroyRenderer(renderer);
+	if (window) SDL_DestroyWindow(window);
+	Assets_Close();
+	SDL_Quit();
+}
+
+
+// Command line usage //
+static void usage(const char *name) {
+	fprintf(stderr, "usage: %s [--json FILE] [--baseline FILE] [--tolerance PCT] [--reps N] [--filter TEXT]\n", name);
+}
+
+
+// Main //
+int main(int argc, char *argv[]) {
+
+	// Command line options //
+	const char *json_path = NULL, *baseline_path = NULL, *filter = NULL;
+	double tolerance = BENCH_TOLERANCE;
+	int reps = BENCH_REPS;
+	for (int i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+			json_path = argv[++i];
+		} else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+			baseline_path = argv[++i];
+		} else if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+			tolerance = atof(argv[++i]);
+		} else if (strcmp(argv[i], "--reps") == 0 && i + 1 < argc) {
+			reps = atoi(argv[++i]);
+			if (reps < 1 || reps > BENCH_REPS * 8) {
+				usage(argv[0]);
+				return 1;
+			}
+		} else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+			filter = argv[++i];
+		} else {
+			usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if (!setup()) {
+		fprintf(stderr, "Could not set up benchmarks: %s\n", SDL_GetError());
+		teardown();
+		return 1;
+	}
+
+	Result baseline[BENCH_MAX];
+	const int baseline_count = baseline_path ? read_baseline(baseline_path, baseline) : -1;
+	// a missing baseline would let every regression through, so it fails the run //
+	if (baseline_path && baseline_count < 0) {
+		fprintf(stderr, "No baseline at %s, record one with make bench-baseline\n", baseline_path);
+		teardown();
+		return 1;
+	}
+
+	// run and compare //
+	Result results[SDL_arraysize(benchmarks)];
+	int count = 0, regressions = 0;
+	printf("%-24s %12s %12s %9s\n", "benchmark", "ns/op", "baseline", "change");
+	for (size_t i = 0; i < SDL_arraysize(benchmarks); ++i) {
+		if (filter && !strstr(benchmarks[i].name, filter)) continue;
+		Result *result = &results[count++];
+		*result = measure(&benchmarks[i], reps);
+		printf("%-24s %12.2f", result->name, result->ns_per_op);
+		const Result *base = NULL;
+		for (int b = 0; b < baseline_count; ++b) {
+			if (strcmp(baseline[b].name, result->name) == 0) base = &baseline[b];
+		}
+		if (base && base->ns_per_op > 0) {
+			const double change = (result->ns_per_op / base->ns_per_op - 1) * 100;
+			const bool regressed = change > tolerance;
+			regressions += regressed;
+			printf(" %12.2f %+8.1f%%%s\n", base->ns_per_op, change, regressed ? "  REGRESSION" : "");
+		} else {
+			printf(" %12s %9s\n", "-", "-");
+		}
+	}
+
+	bool ok = true;
+	if (json_path && !write_json(json_path, results, count, reps)) {
+		fprintf(stderr, "Could not write results: %s\n", SDL_GetError());
+		ok = false;
+	}
+	teardown();
+	if (regressions) {
+		fprintf(stderr, "%d benchmark%s regressed more than %.0f%% against %s\n",
+			regressions, regressions == 1 ? "" : "s", tolerance, baseline_path);
+		return 1;
+	}
+	return ok ? 0 : 1;
+}
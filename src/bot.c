@@ -0,0 +1,159 @@
+///////////////////////////|
+//|File: bot.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Scripted players for batch runs. A policy only reads the game and picks
+ * a direction each step, so any number of games can be played at once.
+ * Add a policy to the table at the bottom to make it selectable by name.
+ */
+
+//----------------------------------------------------------------
+
+// Includes //
+#include <stdbool.h>
+
+// SDL2 //
+#include <SDL2/SDL.h>
+
+// Header Files //
+#include "tilesheet.h"
+#include "ship.h"
+#include "game.h"
+#include "bot.h"
+#include "shared.h"
+
+// Asteroids close enough to matter //
+struct Threats {
+	const Asteroid_Field *rocks;
+	int row;					// grid row being gathered
+	Uint32 count;
+	Uint32 rocks_near[BOT_ROCKS];
+};
+
+
+// Never moves //
+static int decide_still(const Game *game, float delta_t, Uint64 *state) {
+	(void)game;
+	(void)delta_t;
+	(void)state;
+	return 0;
+}
+
+
+// Holds a random direction for a random while //
+static int decide_random(const Game *game, float delta_t, Uint64 *state) {
+	// the chance is per second rather than per step, so any tick rate changes as often //
+	const double chance = (Game_Random(state) >> 11) * 0x1.0p-53;
+	if (chance >= BOT_RANDOM_CHANGES * delta_t) return game->ship_direction;
+	return (int)(Game_Random(state) % 3) - 1;
+}
+
+
+// Keeps asteroids filed under the row being gathered, the query also visits the row above //
+static bool gather(Uint32 rock, void *userdata) {
+
+	struct Threats *threats = userdata;
+	if ((int)threats->rocks->y[rock] / GRID_CELL != threats->row) return false;
+	threats->rocks_near[threats->count++] = rock;
+	return threats->count == BOT_ROCKS;
+}
+
+
+// Seconds until the ship moving in direction meets any threat, BOT_HORIZON when none do //
+static float time_to_hit(const Game *game, const struct Threats *threats, int direction) {
+
+	const Asteroid_Field *rocks = game->rocks;
+	for (int sample = 1; sample <= BOT_SAMPLES; ++sample) {
+		const float t = BOT_HORIZON * sample / BOT_SAMPLES;
+		float ship = game->ship_position + direction * SHIP_VELOCITY * t;
+		if (ship < 0) ship = 0;
+		else if (ship > WIDTH - SHIP_WIDTH) ship = WIDTH - SHIP_WIDTH;
+		for (Uint32 i = 0; i < threats->count; ++i) {
+			const Uint32 rock = threats->rocks_near[i];
+			const float size = rocks->size[rock];
+			const float y = rocks->y[rock] + rocks->velocity[rock] * t + 0.5f * ASTEROID_ACCEL * t * t;
+			if (
+				rocks->x[rock] < ship + SHIP_WIDTH && ship < rocks->x[rock] + size &&
+				y < SHIP_Y + SHIP_HEIGHT && SHIP_Y < y + size
+			) {
+				return t;
+			}
+		}
+	}
+	return BOT_HORIZON;
+}
+
+
+// Looks ahead for each direction and takes the one that is hit last, the ship's box stands in for its pixels //
+static int decide_dodge(const Game *game, float delta_t, Uint64 *state) {
+
+	(void)delta_t;
+	(void)state;
+	const float reach = SHIP_VELOCITY * BOT_HORIZON + GRID_CELL;
+	struct Threats threats = {.rocks = game->rocks};
+	const SDL_Rect column = {game->ship_position - reach, 0, SHIP_WIDTH + 2 * reach, GRID_CELL};
+	for (threats.row = (SHIP_Y + SHIP_HEIGHT) / GRID_CELL; threats.row >= 0 && threats.count < BOT_ROCKS; --threats.row) {
+		SDL_Rect band = column;
+		band.y = threats.row * GRID_CELL;
+		Collision_Grid_Query(game->grid, &band, gather, &threats);
+	}
+
+	// drift back to the middle when that is safe, so both sides stay open //
+	const float offset = game->ship_position - (WIDTH - SHIP_WIDTH) / 2;
+	const int drift = offset > SHIP_WIDTH ? -1 : offset < -SHIP_WIDTH ? 1 : 0;
+	if (time_to_hit(game, &threats, drift) >= BOT_HORIZON) return drift;
+
+	// otherwise keep going unless another way is hit later //
+	const int current = game->ship_direction;
+	const int order[3] = {current, current ? 0 : -1, current ? -current : 1};
+	int best = current;
+	float best_time = -1;
+	for (int i = 0; i < 3; ++i) {
+		const float t = time_to_hit(game, &threats, order[i]);
+		if (t > best_time) {
+			best_time = t;
+			best = order[i];
+		}
+	}
+	return best;
+}
+
+
+// Every policy, the first is the default //
+const Bot_Policy bot_policies[] = {
+	{"dodge", "looks ahead and moves away from the asteroid that would hit first", decide_dodge},
+	{"still", "never moves", decide_still},
+	{"random", "wanders left and right at random", decide_random}
+};
+const int bot_policy_count = SDL_arraysize(bot_policies);
+
+
+// Policy with the given name, NULL if there is none //
+const Bot_Policy *Bot_Find(const char *name) {
+
+	for (int i = 0; i < bot_policy_count; ++i) {
+		if (SDL_strcmp(bot_policies[i].name, name) == 0) return &bot_policies[i];
+	}
+	return NULL;
+}
+
+
+// Plays one game to the end or max_ticks steps, returns the steps taken //
+Uint64 Bot_Play(Game *game, const Bot_Policy *policy, Uint64 seed, float delta_t, Uint64 max_ticks) {
+
+	Game_Init(game, seed);
+	Uint64 state = seed ^ 0x9E3779B97F4A7C15ull;
+	Uint64 tick = 0;
+	while (tick < max_ticks && !game->over) {
+		game->ship_direction = policy->decide(game, delta_t, &state);
+		Game_Step(game, delta_t);
+		++tick;
+	}
+	return tick;
+}
@@ -0,0 +1,38 @@
+///////////////////////////|
+//|File: bot.h
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+//----------------------------------------------------------------
+
+#ifndef BOT_H
+#define BOT_H
+
+#include "game.h"
+
+#define BOT_HORIZON 0.75f		// seconds ahead the dodging bot looks
+#define BOT_SAMPLES 24			// times it checks within the horizon
+#define BOT_ROCKS 256			// asteroids it considers at once, nearest rows first
+#define BOT_RANDOM_CHANGES 2	// direction changes a second the random bot averages
+
+// Picks the ship direction for the next step of delta_t seconds, state is the policy's own and starts from the game seed //
+typedef int (*Bot_Decide)(const Game *game, float delta_t, Uint64 *state);
+
+// A scripted player //
+typedef struct {
+	const char *name;
+	const char *description;
+	Bot_Decide decide;
+} Bot_Policy;
+
+extern const Bot_Policy bot_policies[];
+extern const int bot_policy_count;
+
+const Bot_Policy *Bot_Find(const char *name);
+
+Uint64 Bot_Play(Game *game, const Bot_Policy *policy, Uint64 seed, float delta_t, Uint64 max_ticks);
+
+#endif
@@ -0,0 +1,101 @@
+///////////////////////////|
+//|File: entity.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Handle based entity pool. Live entities stay packed at the front of their
+ * component arrays so update kernels run over one dense range, despawning
+ * moves the last entity into the hole. Handles carry a generation so a
+ * handle kept past its entity's despawn never resolves to the entity that
+ * reuses the slot. Spawn and despawn are O(1) and never allocate.
+ */
+
+//----------------------------------------------------------------
+
+// SDL2 //
+#include <SDL2/SDL.h>
+
+// Header Files //
+#include "arena.h"
+#include "entity.h"
+
+
+// Arena space Entity_Pool_Init takes //
+size_t Entity_Pool_Footprint(Uint32 capacity) {
+	return 3 * ARENA_FOOTPRINT(capacity * sizeof(Uint32));
+}
+
+
+// Carves the pool's tables from the arena, every slot starts dead //
+bool Entity_Pool_Init(Entity_Pool *pool, Arena *arena, Uint32 capacity) {
+
+	*pool = (Entity_Pool) {
+		.dense = Arena_Alloc(arena, capacity * sizeof(Uint32)),
+		.index = Arena_Alloc(arena, capacity * sizeof(Uint32)),
+		.generation = Arena_Alloc(arena, capacity * sizeof(Uint32)),
+		.capacity = capacity
+	};
+	if (!pool->dense || !pool->index || !pool->generation) return false;
+	SDL_memset(pool->generation, 0, capacity * sizeof(Uint32));
+	Entity_Pool_Clear(pool);
+	return true;
+}
+
+
+// Despawns every entity at once //
+void Entity_Pool_Clear(Entity_Pool *pool) {
+
+	for (Uint32 i = 0; i < pool->count; ++i) ++pool->generation[pool->dense[i]];
+	for (Uint32 slot = 0; slot < pool->capacity; ++slot) pool->index[slot] = slot + 1;
+	pool->count = 0;
+	pool->free_slot = 0;
+}
+
+
+// Spawns an entity at component index count - 1, ENTITY_NONE when the pool is full //
+Entity Entity_Spawn(Entity_Pool *pool) {
+
+	const Uint32 slot = pool->free_slot;
+	if (slot >= pool->capacity) return ENTITY_NONE;
+	pool->free_slot = pool->index[slot];
+	pool->index[slot] = pool->count;
+	pool->dense[pool->count++] = slot;
+	return (Entity) {slot, pool->generation[slot]};
+}
+
+
+// Despawns an entity, returns the component index it freed or ENTITY_INVALID if it was not alive.
+// The entity that was last now belongs at that index, its components must be moved from index count. //
+Uint32 Entity_Despawn(Entity_Pool *pool, Entity entity) {
+
+	const Uint32 hole = Entity_Index(pool, entity);
+	if (hole == ENTITY_INVALID) return ENTITY_INVALID;
+	const Uint32 moved = pool->dense[--pool->count];
+	pool->dense[hole] = moved;
+	pool->index[moved] = hole;
+	++pool->generation[entity.slot];
+	pool->index[entity.slot] = pool->free_slot;
+	pool->free_slot = entity.slot;
+	return hole;
+}
+
+
+// Component index of a live entity, ENTITY_INVALID for a stale handle //
+Uint32 Entity_Index(const Entity_Pool *pool, Entity entity) {
+
+	if (entity.slot >= pool->capacity || pool->generation[entity.slot] != entity.generation) return ENTITY_INVALID;
+	const Uint32 index = pool->index[entity.slot];
+	return index < pool->count && pool->dense[index] == entity.slot ? index : ENTITY_INVALID;
+}
+
+
+// Handle of the entity at a component index //
+Entity Entity_At(const Entity_Pool *pool, Uint32 index) {
+	const Uint32 slot = pool->dense[index];
+	return (Entity) {slot, pool->generation[slot]};
+}
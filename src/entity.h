@@ -0,0 +1,54 @@
+///////////////////////////|
+//|File: entity.h
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+//----------------------------------------------------------------
+
+#ifndef ENTITY_H
+#define ENTITY_H
+
+#include <stdbool.h>
+
+#include <SDL2/SDL_stdinc.h>
+
+#include "arena.h"
+
+#define ENTITY_INVALID 0xFFFFFFFF	// index of an entity that is not alive
+
+// Handle to a pooled entity, stale once the entity is despawned //
+typedef struct {
+	Uint32 slot;		// fixed for the entity's lifetime
+	Uint32 generation;	// must match the slot's for the handle to resolve
+} Entity;
+
+#define ENTITY_NONE ((Entity) {ENTITY_INVALID, 0})
+
+// Maps handles to a dense range of component indices [0, count) //
+typedef struct {
+	Uint32 *dense;			// slot of each live entity, in component order
+	Uint32 *index;			// component index of a live slot, next free slot of a dead one
+	Uint32 *generation;		// bumped on despawn so old handles stop resolving
+	Uint32 capacity;
+	Uint32 count;			// live entities
+	Uint32 free_slot;		// first dead slot, capacity when the pool is full
+} Entity_Pool;
+
+size_t Entity_Pool_Footprint(Uint32 capacity);
+
+bool Entity_Pool_Init(Entity_Pool *pool, Arena *arena, Uint32 capacity);
+
+void Entity_Pool_Clear(Entity_Pool *pool);
+
+Entity Entity_Spawn(Entity_Pool *pool);
+
+Uint32 Entity_Despawn(Entity_Pool *pool, Entity entity);
+
+Uint32 Entity_Index(const Entity_Pool *pool, Entity entity);
+
+Entity Entity_At(const Entity_Pool *pool, Uint32 index);
+
+#endif
@@ -11,33 +11,79 @@
 #include <SDL.h>
 
 #include "tilesheet.h"
+#include "quad.h"
 #include "font.h"
 
+#define FIRST_GLYPH 33
+#define GLYPH_COUNT (128 - FIRST_GLYPH)
+#define BATCH_GLYPHS 128
+
 struct Font {
     TileSheet *ts;
     int scale;
+    SDL_FRect glyphs[GLYPH_COUNT]; // texture coordinates of each printable character
+    Quad_Batch *batch; // glyph quads for the text being rendered
 };
 
-Font *Font_create(const char *file_path, SDL_Renderer *renderer, int scale) {
+Font *Font_createFromTileSheet(TileSheet *ts, int scale) {
     Font *ret = malloc(sizeof(Font));
-	ret->ts = TileSheet_create(file_path, renderer, 8, 8, 0);
+	if (!ret) {
+		TileSheet_destroy(ts);
+		SDL_SetError("Failed to allocate memory for font.");
+		return NULL;
+	}
+	ret->ts = ts;
+	ret->batch = Quad_Batch_Create(BATCH_GLYPHS);
+	if (!ret->batch) {
+		Font_destroy(ret);
+		return NULL;
+	}
 	ret->scale = scale;
+
+	// Glyph source rects are looked up once here instead of per character.
+	// They are relative to the whole texture, which may be an atlas.
+	int tex_w, tex_h;
+	SDL_QueryTexture(ret->ts->texture, NULL, NULL, &tex_w, &tex_h);
+	for (int i = 0; i < GLYPH_COUNT; ++i) {
+		SDL_Rect src = TileSheet_getTileRect(ret->ts, i);
+		ret->glyphs[i] = (SDL_FRect) {
+			.x = (float)src.x / tex_w,
+			.y = (float)src.y / tex_h,
+			.w = (float)src.w / tex_w,
+			.h = (float)src.h / tex_h
+		};
+	}
 	return ret;
 }
 
+Font *Font_create(const char *file_path, SDL_Renderer *renderer, int scale) {
+	TileSheet *ts = TileSheet_create(file_path, renderer, 8, 8, 0);
+	return ts ? Font_createFromTileSheet(ts, scale) : NULL;
+}
+
+Font *Font_createInAtlas(const char *file_path, Atlas *atlas, int scale) {
+	TileSheet *ts = TileSheet_createInAtlas(file_path, atlas, 8, 8, 0);
+	return ts ? Font_createFromTileSheet(ts, scale) : NULL;
+}
+
 void Font_destroy(Font *font) {
+	if (!font) return;
 	TileSheet_destroy(font->ts);
+	Quad_Batch_Destroy(font->batch);
 	free(font);
 }
 
-SDL_Rect Font_renderText(Font *font, SDL_Renderer *renderer, const SDL_Point *dst_point, const char *text) {
-	const SDL_Point orig_p = dst_point == NULL ? (SDL_Point) {0} : *dst_point;
+// Queues glyph quads for text starting at orig_p, drawing early if the batch fills up.
+static SDL_Rect layout_text(Font *font, Quad_Batch *batch, SDL_Renderer *renderer, SDL_Point orig_p, const char *text) {
 	SDL_Point p = orig_p;
 
+	const SDL_Color white = {255, 255, 255, 255};
+	const float size = 8 * font->scale;
 	int max_x = p.x;
 	for (const char *c = text; *c != '\0'; ++c) {
-		if (*c < 33) {
-			switch (*c) {
+		const unsigned char ch = *c;
+		if (ch < FIRST_GLYPH) {
+			switch (ch) {
 			case '\b':
 				p.x -= 8 * font->scale;
 				break;
@@ -56,9 +102,16 @@ SDL_Rect Font_renderText(Font *font, SDL_Renderer *renderer, const SDL_Point *ds
 				break;
 			}
 		} else {
-			SDL_Rect src = TileSheet_getTileRect(font->ts, *c - 33);
-			SDL_Rect dst = {.x = p.x, .y = p.y, .w = 8 * font->scale, .h = 8 * font->scale};
-			SDL_RenderCopy(renderer, font->ts->texture, &src, &dst);
+			// Bytes past the font's table are drawn as a question mark.
+			const int glyph = ch < FIRST_GLYPH + GLYPH_COUNT ? ch : '?';
+			const SDL_FRect *uv = &font->glyphs[glyph - FIRST_GLYPH];
+			SDL_FRect dst = {.x = p.x, .y = p.y, .w = size, .h = size};
+			if (!Quad_Batch_AddTextured(batch, &dst, uv, white) && renderer) {
+				// Batch is full, draw what we have and start over.
+				Quad_Batch_Render(batch, renderer, font->ts->texture);
+				Quad_Batch_Clear(batch);
+				Quad_Batch_AddTextured(batch, &dst, uv, white);
+			}
 			p.x += 8 * font->scale;
 		}
 	}
@@ -73,6 +126,14 @@ SDL_Rect Font_renderText(Font *font, SDL_Renderer *renderer, const SDL_Point *ds
 	};
 }
 
+SDL_Rect Font_renderText(Font *font, SDL_Renderer *renderer, const SDL_Point *dst_point, const char *text) {
+	const SDL_Point orig_p = dst_point == NULL ? (SDL_Point) {0} : *dst_point;
+	Quad_Batch_Clear(font->batch);
+	SDL_Rect bounds = layout_text(font, font->batch, renderer, orig_p, text);
+	Quad_Batch_Render(font->batch, renderer, font->ts->texture);
+	return bounds;
+}
+
 SDL_Rect Font_renderFormatted(Font *font, SDL_Renderer *renderer, const SDL_Point *dst_point, const char *format, ...) {
 	va_list ap;
 	char *text;
@@ -84,3 +145,122 @@ SDL_Rect Font_renderFormatted(Font *font, SDL_Renderer *renderer, const SDL_Poin
 	SDL_free(text);
 	return r;
 }
+
+struct CachedText {
+	Font *font;
+	SDL_Point point; // top-left of the text in the renderer
+	char text[CACHEDTEXT_MAX]; // current contents
+	SDL_bool dirty; // contents changed since the last render
+	SDL_bool baked; // draw from a render-target texture instead of glyph quads
+	Quad_Batch *batch; // laid-out glyphs
+	SDL_Rect bounds; // bounds of the laid-out text
+	SDL_Texture *texture; // baked text, only when baked
+	int tex_w, tex_h; // size of the baked texture
+};
+
+CachedText *CachedText_create(Font *font, const SDL_Point *dst_point, SDL_bool baked) {
+	CachedText *text = SDL_malloc(sizeof(CachedText));
+	if (!text) {
+		SDL_SetError("Failed to allocate memory for cached text.");
+		return NULL;
+	}
+	*text = (CachedText) {
+		.font = font,
+		.point = dst_point == NULL ? (SDL_Point) {0} : *dst_point,
+		.dirty = SDL_TRUE,
+		.baked = baked,
+		.batch = Quad_Batch_Create(CACHEDTEXT_MAX)
+	};
+	if (!text->batch) {
+		SDL_free(text);
+		return NULL;
+	}
+	return text;
+}
+
+void CachedText_destroy(CachedText *text) {
+	if (!text) return;
+	Quad_Batch_Destroy(text->batch);
+	if (text->texture) SDL_DestroyTexture(text->texture);
+	SDL_free(text);
+}
+
+SDL_bool CachedText_set(CachedText *text, const char *string) {
+	if (SDL_strcmp(text->text, string) == 0) return SDL_FALSE;
+	SDL_strlcpy(text->text, string, sizeof(text->text));
+	text->dirty = SDL_TRUE;
+	return SDL_TRUE;
+}
+
+SDL_bool CachedText_setFormatted(CachedText *text, const char *format, ...) {
+	char buf[CACHEDTEXT_MAX];
+	va_list ap;
+	va_start(ap, format);
+	SDL_vsnprintf(buf, sizeof(buf), format, ap);
+	va_end(ap);
+	return CachedText_set(text, buf);
+}
+
+void CachedText_invalidate(CachedText *text) {
+	text->dirty = SDL_TRUE;
+}
+
+// Renders the laid-out glyphs into the text's own texture, growing it if needed.
+static SDL_bool bake_text(CachedText *text, SDL_Renderer *renderer) {
+	if (text->bounds.w <= 0 || text->bounds.h <= 0) return SDL_TRUE;
+	if (!text->texture || text->tex_w < text->bounds.w || text->tex_h < text->bounds.h) {
+		if (text->texture) SDL_DestroyTexture(text->texture);
+		text->tex_w = SDL_max(text->bounds.w, text->tex_w);
+		text->tex_h = SDL_max(text->bounds.h, text->tex_h);
+		text->texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, text->tex_w, text->tex_h);
+		if (!text->texture) return SDL_FALSE;
+		SDL_SetTextureBlendMode(text->texture, SDL_BLENDMODE_BLEND);
+	}
+
+	SDL_Texture *prev_target = SDL_GetRenderTarget(renderer);
+	if (SDL_SetRenderTarget(renderer, text->texture) < 0) return SDL_FALSE;
+	Uint8 r, g, b, a;
+	SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+	SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+	SDL_RenderClear(renderer);
+	SDL_SetRenderDrawColor(renderer, r, g, b, a);
+	Quad_Batch_Render(text->batch, renderer, text->font->ts->texture);
+	SDL_SetRenderTarget(renderer, prev_target);
+	return SDL_TRUE;
+}
+
+SDL_Rect CachedText_render(CachedText *text, SDL_Renderer *renderer) {
+	if (text->dirty) {
+		// Baked text is laid out at the texture origin and copied into place.
+		const SDL_Point origin = text->baked ? (SDL_Point) {0} : text->point;
+		Quad_Batch_Clear(text->batch);
+		text->bounds = layout_text(text->font, text->batch, NULL, origin, text->text);
+		if (text->baked && !bake_text(text, renderer)) {
+			// Render targets are unavailable, fall back to drawing the glyphs.
+			text->baked = SDL_FALSE;
+			Quad_Batch_Clear(text->batch);
+			text->bounds = layout_text(text->font, text->batch, NULL, text->point, text->text);
+		}
+		text->dirty = SDL_FALSE;
+	}
+
+	if (text->baked) {
+		if (text->texture && text->bounds.w > 0 && text->bounds.h > 0) {
+			const SDL_Rect src = {0, 0, text->bounds.w, text->bounds.h};
+			const SDL_Rect dst = {text->point.x, text->point.y, text->bounds.w, text->bounds.h};
+			SDL_RenderCopy(renderer, text->texture, &src, &dst);
+		}
+		return (SDL_Rect) {text->point.x, text->point.y, text->bounds.w, text->bounds.h};
+	}
+	Quad_Batch_Render(text->batch, renderer, text->font->ts->texture);
+	return text->bounds;
+}
+
+const Quad_Batch *CachedText_getBatch(CachedText *text) {
+	if (text->dirty) {
+		Quad_Batch_Clear(text->batch);
+		text->bounds = layout_text(text->font, text->batch, NULL, text->point, text->text);
+		text->dirty = SDL_FALSE;
+	}
+	return text->batch;
+}
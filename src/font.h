@@ -10,6 +10,7 @@
 #define MOONLANDER_FONT_H
 
 #include "tilesheet.h"
+#include "quad.h"
 
 /// @brief This is implemented as an abstraction of tilesheets.
 typedef struct Font Font;
@@ -23,6 +24,24 @@ typedef struct Font Font;
  */
 Font *Font_create(const char *file_path, SDL_Renderer *renderer, int scale);
 
+/**
+ * @brief Create a font object whose glyphs are packed into an atlas
+ *
+ * @param file_path Path to a Windows bitmap file containing the font
+ * @param atlas Atlas to pack the glyphs into
+ * @return The newly created font object
+ */
+Font *Font_createInAtlas(const char *file_path, Atlas *atlas, int scale);
+
+/**
+ * @brief Create a font object from a tilesheet of 8x8 glyphs
+ * @details The font takes ownership of the tilesheet, and destroys it even if creation fails.
+ *
+ * @param tilesheet Tilesheet containing the glyphs, starting at '!'
+ * @return The newly created font object
+ */
+Font *Font_createFromTileSheet(TileSheet *tilesheet, int scale);
+
 /**
  * @brief Free all resources associated with a font object
  *
@@ -32,6 +51,7 @@ void Font_destroy(Font *font);
 
 /**
  * @brief Render text using a font.
+ * @details The glyphs are submitted together with one SDL_RenderGeometry call.
  *
  * @param font The font to use
  * @param renderer The renderer to render to
@@ -53,4 +73,76 @@ SDL_Rect Font_renderText(Font *font, SDL_Renderer *renderer, const SDL_Point *ds
  */
 SDL_Rect Font_renderFormatted(Font *font, SDL_Renderer *renderer, const SDL_Point *dst_point, const char *format, ...);
 
+/// @brief Longest string a cached text can hold, including the terminator.
+#define CACHEDTEXT_MAX 64
+
+/// @brief Retained text that is only laid out again when its contents change.
+typedef struct CachedText CachedText;
+
+/**
+ * @brief Create a cached text object
+ * @details All memory is allocated here, so setting and rendering the text never allocates.
+ * Baked text is drawn once into its own render-target texture and then copied with a single call.
+ *
+ * @param font The font to use, which must outlive the text
+ * @param dst_point The start coordinate in the renderer (top-left) for the text.
+ * @param baked Whether to keep the text in a render-target texture
+ * @return The newly created cached text
+ */
+CachedText *CachedText_create(Font *font, const SDL_Point *dst_point, SDL_bool baked);
+
+/**
+ * @brief Free all resources associated with a cached text object
+ *
+ * @param text The cached text to destroy
+ */
+void CachedText_destroy(CachedText *text);
+
+/**
+ * @brief Change the contents of a cached text.
+ * @details Strings longer than CACHEDTEXT_MAX - 1 characters are truncated.
+ *
+ * @param text The cached text to change
+ * @param string The new contents
+ * @return SDL_TRUE if the contents changed
+ */
+SDL_bool CachedText_set(CachedText *text, const char *string);
+
+/**
+ * @brief Change the contents of a cached text using a printf-style format.
+ * @details The string is formatted into a fixed buffer, so this never allocates.
+ *
+ * @param text The cached text to change
+ * @param format The printf-style format argument
+ * @param ... All other printf-style arguments
+ * @return SDL_TRUE if the contents changed
+ */
+SDL_bool CachedText_setFormatted(CachedText *text, const char *format, ...);
+
+/**
+ * @brief Mark a cached text to be laid out and baked again on its next render.
+ * @details Call this after SDL_RENDER_TARGETS_RESET, which clears baked text textures.
+ *
+ * @param text The cached text to invalidate
+ */
+void CachedText_invalidate(CachedText *text);
+
+/**
+ * @brief Render a cached text, laying it out again only if its contents changed.
+ *
+ * @param text The cached text to render
+ * @param renderer The renderer to render to
+ * @return A rectangle containing the bounds of the rendered text
+ */
+SDL_Rect CachedText_render(CachedText *text, SDL_Renderer *renderer);
+
+/**
+ * @brief Get the glyph quads of a cached text, laying it out again only if its contents changed.
+ * @details For drawing the text without the renderer. Only valid for text that is not baked.
+ *
+ * @param text The cached text to lay out
+ * @return The text's quads, sampling the font's texture
+ */
+const Quad_Batch *CachedText_getBatch(CachedText *text);
+
 #endif
@@ -0,0 +1,329 @@
+///////////////////////////|
+//|File: game.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Game simulation, asteroids, ship movement and collisions.
+ * Nothing in here touches the window, renderer or mixer.
+ * Collisions are swept over the whole step, so a fast asteroid or a
+ * coarse tick rate can't carry a rock through the ship between steps.
+ */
+
+//----------------------------------------------------------------
+
+// Includes //
+#include <stdlib.h>
+#include <stdbool.h>
+
+// SDL2 //
+#include <SDL2/SDL.h>
+
+// Header Files //
+#include "tilesheet.h"
+#include "ship.h"
+#include "arena.h"
+#include "entity.h"
+#include "asteroids.h"
+#include "grid.h"
+#include "game.h"
+#include "profiler.h"
+#include "shared.h"
+
+
+// Create game with room for rock_count asteroids, all of it in one arena //
+Game *Game_Create(size_t rock_count) {
+
+	Arena *arena = Arena_Create(
+		ARENA_FOOTPRINT(sizeof(Game)) + Asteroid_Field_Footprint(rock_count) + Collision_Grid_Footprint(rock_count)
+	);
+	if (!arena) return NULL;
+	Game *game = Arena_Alloc(arena, sizeof(Game));
+	if (!game) {
+		Arena_Destroy(arena);
+		return NULL;
+	}
+	*game = (Game) {
+		.arena = arena,
+		.rocks = Asteroid_Field_Create(arena, rock_count),
+		.grid = Collision_Grid_Create(arena, rock_count)
+	};
+	if (!game->rocks || !game->grid) {
+		Arena_Destroy(arena);
+		return NULL;
+	}
+	Game_Init(game, 0);
+	return game;
+}
+
+
+// Destroy game //
+void Game_Destroy(Game *game) {
+	if (!game) return;
+	Arena_Destroy(game->arena);
+}
+
+
+// Next value of a splitmix64 sequence, also used by callers to derive seeds //
+Uint64 Game_Random(Uint64 *state) {
+	Uint64 z = (*state += 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+
+// Random integer in [0, n) from the game's own sequence //
+static int random_below(Game *game, int n) {
+	return Game_Random(&game->rng) % n;
+}
+
+
+// Respawns an asteroid at a random x position //
+static void respawn(Game *game, size_t i, float y) {
+	Asteroid_Field *rocks = game->rocks;
+	rocks->x[i] = random_below(game, WIDTH - (int)rocks->size[i]);
+	rocks->y[i] = y;
+	rocks->prev_y[i] = y;
+}
+
+
+// Initialize the player and asteroids, everything random follows from seed //
+void Game_Init(Game *game, Uint64 seed) {
+
+	game->ship_position = WIDTH / 2;
+	game->prev_ship_position = game->ship_position;
+	game->ship_direction = 0;
+	game->time = 0;
+	game->points_timer = 0;
+	game->over = false;
+	game->rng = seed;
+	game->fastest = 0;
+	game->fall = 0;
+	game->escaped_impact = GAME_NO_IMPACT;
+	game->impact = GAME_NO_IMPACT;
+	Asteroid_Field *rocks = game->rocks;
+	Asteroid_Field_Clear(rocks);
+	for (size_t i = 0; i < rocks->entities.capacity; ++i) {
+		const float velocity = random_below(game, 100) + 50;
+		const float size = random_below(game, 5) + 5; // range from 5-15
+		const float x = random_below(game, WIDTH - (int)size);
+		const float y = -random_below(game, HEIGHT) - size;
+		Asteroid_Field_Spawn(rocks, x, y, velocity, size);
+		if (velocity > game->fastest) game->fastest = velocity;
+	}
+	Collision_Grid_Clear(game->grid);
+	Collision_Grid_Update(game->grid, rocks);
+}
+
+
+// Adds an asteroid mid game, ENTITY_NONE when the field is full //
+Entity Game_SpawnRock(Game *game, float x, float y, float velocity, float size) {
+	if (velocity > game->fastest) game->fastest = velocity;
+	return Asteroid_Field_Spawn(game->rocks, x, y, velocity, size);
+}
+
+
+// Removes an asteroid mid game, false if the handle is stale //
+bool Game_DespawnRock(Game *game, Entity rock) {
+
+	const Uint32 hole = Asteroid_Field_Despawn(game->rocks, rock);
+	if (hole == ENTITY_INVALID) return false;
+	// the hole now holds the old last asteroid, both are filed again on the next update //
+	Collision_Grid_Remove(game->grid, hole);
+	Collision_Grid_Remove(game->grid, game->rocks->count);
+	return true;
+}
+
+
+// Narrows the part of the step where start + motion * t lies in [low, high), false when nothing is left //
+static bool slab(float start, float motion, float low, float high, float *enter, float *exit) {
+
+	if (motion == 0) return start >= low && start < high;
+	float t0 = (low - start) / motion, t1 = (high - start) / motion;
+	if (t0 > t1) {
+		const float t = t0;
+		t0 = t1;
+		t1 = t;
+	}
+	if (t0 > *enter) *enter = t0;
+	if (t1 < *exit) *exit = t1;
+	return *enter <= *exit;
+}
+
+
+// Whether a rock box touches the ship box, and the ship's pixels when it has a mask //
+static bool touches(const Game *game, const SDL_Rect *ship, const SDL_Rect *rock) {
+
+	SDL_Rect overlap;
+	if (!SDL_IntersectRect(ship, rock, &overlap)) return false;
+	if (!game->ship_masked) return true;
+
+	// rocks are solid, so each overlapped ship row is tested against one span of bits //
+	const int left = overlap.x - ship->x, top = overlap.y - ship->y;
+	const Uint64 span = (overlap.w >= 64 ? ~(Uint64)0 : ((Uint64)1 << overlap.w) - 1) << left;
+	for (int y = top; y < top + overlap.h; ++y) {
+		if (game->ship_mask[y] & span) return true;
+	}
+	return false;
+}
+
+
+// Earliest fraction of the last step at which a rock falling from y0 to y1 touches the ship, GAME_NO_IMPACT if it never does //
+static float sweep(const Game *game, float x, float y0, float y1, float size) {
+
+	// whole pixel boxes overlap while the ship's x is in [x - SHIP_WIDTH + 1, x + size) and the rock's y in [SHIP_Y - size + 1, SHIP_Y + SHIP_HEIGHT) //
+	const int rock_x = x, rock_size = size;
+	const float start = game->prev_ship_position, motion = game->ship_position - start, fall = y1 - y0;
+	float enter = 0, exit = 1;
+	if (
+		!slab(start, motion, rock_x - SHIP_WIDTH + 1, rock_x + rock_size, &enter, &exit) ||
+		!slab(y0, fall, SHIP_Y - rock_size + 1, SHIP_Y + SHIP_HEIGHT, &enter, &exit)
+	) {
+		return GAME_NO_IMPACT;
+	}
+	if (!game->ship_masked && enter < exit) return enter;
+
+	// otherwise every whole pixel arrangement the boxes pass through is tested in order, the first holds at enter and the last at exit //
+	const SDL_Rect rock_box = {rock_x, 0, rock_size, rock_size};
+	const int step = motion < 0 ? -1 : 1, drop = fall < 0 ? -1 : 1;
+	int col = start + motion * enter, row = y0 + fall * enter;
+	const int last_col = start + motion * exit, last_row = y0 + fall * exit;
+	for (bool first = true;; first = false) {
+		float col_in = enter, col_out = exit, row_in = enter, row_out = exit;
+		slab(start, motion, col, col + 1, &col_in, &col_out);
+		slab(y0, fall, row, row + 1, &row_in, &row_out);
+		const float t = SDL_max(col_in, row_in);
+		const bool last = col == last_col && row == last_row;
+		if (t < SDL_min(col_out, row_out) || first || last) {
+			const SDL_Rect ship = {col, SHIP_Y, SHIP_WIDTH, SHIP_HEIGHT};
+			SDL_Rect rock = rock_box;
+			rock.y = row;
+			if (touches(game, &ship, &rock)) return SDL_min(t, exit);
+		}
+		if (last) break;
+		// move on from whichever pixel is left first //
+		if (row == last_row || (col != last_col && col_out <= row_out)) col += step;
+		else row += drop;
+	}
+	return GAME_NO_IMPACT;
+}
+
+
+// Moves the ship and asteroids one step and refreshes the broad phase //
+void Game_Physics(Game *game, float delta_t) {
+
+	game->prev_ship_position = game->ship_position;
+	game->ship_position += game->ship_direction * SHIP_VELOCITY * delta_t;
+	if (game->ship_position < 0) game->ship_position = 0;
+	else if (game->ship_position > WIDTH - SHIP_WIDTH) game->ship_position = WIDTH - SHIP_WIDTH;
+
+	// every asteroid falls at most the fastest one's speed this step, a pixel covers rounding //
+	game->fall = game->fastest * delta_t + 1;
+	game->fastest += ASTEROID_ACCEL * delta_t;
+	Asteroid_Field *rocks = game->rocks;
+	size_t respawns = Asteroid_Field_Update(rocks, delta_t, ASTEROID_ACCEL);
+
+	// asteroids that fell off screen leave the grid, so their last fall is swept before they go back up //
+	game->escaped_impact = GAME_NO_IMPACT;
+	for (size_t i = 0; i < respawns; ++i) {
+		Uint32 rock = rocks->respawn[i];
+		const float impact = sweep(game, rocks->x[rock], rocks->prev_y[rock], rocks->y[rock], rocks->size[rock]);
+		if (impact < game->escaped_impact) game->escaped_impact = impact;
+		respawn(game, rock, -rocks->size[rock]);
+	}
+	Collision_Grid_Update(game->grid, rocks);
+}
+
+
+// Ship collision query //
+struct Ship_Query {
+	const Game *game;
+	float impact;					// earliest hit so far
+};
+
+
+// Sweeps one broad phase candidate, stops once nothing could hit sooner //
+static bool hits_ship(Uint32 rock, void *userdata) {
+
+	struct Ship_Query *query = userdata;
+	const Asteroid_Field *rocks = query->game->rocks;
+	const float impact = sweep(query->game, rocks->x[rock], rocks->prev_y[rock], rocks->y[rock], rocks->size[rock]);
+	if (impact < query->impact) query->impact = impact;
+	return query->impact == 0;
+}
+
+
+// Rewinds the ship, asteroids and clock from the end of the last step to t of the way through it //
+static void rewind_step(Game *game, float t, float delta_t) {
+
+	game->time -= (1 - t) * delta_t;
+	game->ship_position = game->prev_ship_position + (game->ship_position - game->prev_ship_position) * t;
+	Asteroid_Field *rocks = game->rocks;
+	for (size_t i = 0; i < rocks->count; ++i) {
+		rocks->y[i] = rocks->prev_y[i] + (rocks->y[i] - rocks->prev_y[i]) * t;
+	}
+	Collision_Grid_Update(game->grid, rocks);
+}
+
+
+// Collisions over the last step, impact is the fraction of it at which the ship was first hit and may be NULL //
+bool Game_Collision(const Game *game, float *impact) {
+
+	// the ship's path, and below it anything that could have fallen through it //
+	const float left = SDL_min(game->prev_ship_position, game->ship_position);
+	const float right = SDL_max(game->prev_ship_position, game->ship_position);
+	const SDL_Rect area = {left, SHIP_Y, (int)(right - left) + SHIP_WIDTH + 1, SHIP_HEIGHT + (int)game->fall + 1};
+	struct Ship_Query query = {game, game->escaped_impact};
+	Collision_Grid_Query(game->grid, &area, hits_ship, &query);
+	if (impact) *impact = query.impact;
+	return query.impact <= 1;
+}
+
+
+// Uses the ship's pixels for hits, SHIP_HEIGHT rows from TileSheet_getTileMask, NULL for the whole box //
+void Game_SetShipMask(Game *game, const Uint64 *rows) {
+	game->ship_masked = rows != NULL;
+	if (rows) SDL_memcpy(game->ship_mask, rows, sizeof(game->ship_mask));
+}
+
+
+// Advances the game by one fixed step of delta_t seconds //
+Uint32 Game_Step(Game *game, float delta_t) {
+
+	Uint32 events = 0;
+	if (game->over) return events;
+	game->time += delta_t;
+	game->points_timer += delta_t;
+	if (game->points_timer >= POINTS_INTERVAL) {
+		game->points_timer -= POINTS_INTERVAL;
+		events |= GAME_EVENT_POINTS;
+	}
+	Uint64 zone = Profiler_Begin();
+	Game_Physics(game, delta_t);
+	Profiler_End(PROFILE_PHYSICS, zone);
+	zone = Profiler_Begin();
+	float impact;
+	const bool hit = Game_Collision(game, &impact);
+	Profiler_End(PROFILE_COLLISION, zone);
+	if (hit) {
+		game->impact = impact;
+		events |= GAME_EVENT_HIT;
+		// the game ends where the ship was hit, not where the step would have left it //
+		if (!game->invulnerable) {
+			game->over = true;
+			rewind_step(game, impact, delta_t);
+		}
+	}
+	return events;
+}
+
+
+// Score is hundredths of a second survived //
+Uint64 Game_Score(const Game *game) {
+	return game->time * 100;
+}
@@ -0,0 +1,76 @@
+///////////////////////////|
+//|File: game.h
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+//----------------------------------------------------------------
+
+#ifndef GAME_H
+#define GAME_H
+
+#include <stdbool.h>
+
+#include "arena.h"
+#include "entity.h"
+#include "asteroids.h"
+#include "grid.h"
+
+// Defines //
+#define TOTAL_ROCKS 15
+#define STRESS_ROCKS 100000
+#define ASTEROID_ACCEL 2
+#define POINTS_INTERVAL 10.0f	// seconds between points sounds
+#define DEFAULT_TICK_RATE 120	// simulation steps per second
+#define GAME_NO_IMPACT 2.0f		// time of impact past the end of any step
+
+// Events returned by Game_Step //
+#define GAME_EVENT_POINTS 0x1	// another points interval was survived
+#define GAME_EVENT_HIT 0x2	// ship collided with a rock
+
+// Game state, no window, renderer or mixer needed //
+typedef struct {
+	Arena *arena;						// holds the game and everything it owns
+	Asteroid_Field *rocks;				// asteroid field
+	Collision_Grid *grid;				// broad phase for the asteroid field
+	float ship_position;				// x position of the player ship
+	float prev_ship_position;			// ship position before the last step
+	int ship_direction;					// current direction of ship movement
+	Uint64 rng;							// random state, the same seed always plays out the same
+	Uint64 ship_mask[SHIP_HEIGHT];		// opaque pixels of the ship, bit x of each row
+	bool ship_masked;					// hits need the mask, otherwise the whole ship box counts
+	double time;						// seconds of simulated play
+	float points_timer;					// seconds since last points event
+	bool over;							// ship has been hit
+	bool invulnerable;					// hits are reported but never end the game
+	float fastest;						// fastest asteroid, they all speed up together so it is tracked without a scan
+	float fall;							// furthest any asteroid can have fallen in the last step
+	float escaped_impact;				// earliest hit by an asteroid that fell off screen in the last step
+	float impact;						// fraction of the last step at which the ship was last hit
+} Game;
+
+Game *Game_Create(size_t rock_count);
+
+void Game_Destroy(Game *game);
+
+void Game_Init(Game *game, Uint64 seed);
+
+Entity Game_SpawnRock(Game *game, float x, float y, float velocity, float size);
+
+bool Game_DespawnRock(Game *game, Entity rock);
+
+Uint32 Game_Step(Game *game, float delta_t);
+
+void Game_Physics(Game *game, float delta_t);
+
+bool Game_Collision(const Game *game, float *impact);
+
+Uint64 Game_Score(const Game *game);
+
+Uint64 Game_Random(Uint64 *state);
+
+void Game_SetShipMask(Game *game, const Uint64 *rows);
+
+#endif
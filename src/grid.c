@@ -0,0 +1,279 @@
+///////////////////////////|
+//|File: grid.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Broad phase collision grid. Asteroids are linked into the cell holding
+ * their top-left corner and only relinked when they cross into a new cell,
+ * so a query only looks at the asteroids near the area being tested.
+ * Finding the asteroids that changed cell has AVX2, SSE2 and plain C versions.
+ */
+
+//----------------------------------------------------------------
+
+// SDL2 //
+#include <SDL2/SDL.h>
+
+// Header Files //
+#include "arena.h"
+#include "asteroids.h"
+#include "grid.h"
+#include "shared.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+#define GRID_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GRID_AVX2
+#include <immintrin.h>
+#endif
+
+// Relinks asteroids [start, count) that changed cell //
+typedef void (*Update_Kernel)(Collision_Grid *grid, const Asteroid_Field *rocks, size_t start);
+
+static Update_Kernel update_kernel;
+
+
+// Cell holding the asteroid's top-left corner, -1 when it is off the playfield //
+static Sint32 cell_of(float x, float y, float size) {
+
+	if (x + size <= 0 || x >= WIDTH || y + size <= 0 || y >= HEIGHT) return -1;
+	int col = x < 0 ? 0 : (int)x / GRID_CELL;
+	int row = y < 0 ? 0 : (int)y / GRID_CELL;
+	return row * GRID_COLS + col;
+}
+
+
+// Unlinks an asteroid from its cell //
+static void unlink_rock(Collision_Grid *grid, Sint32 rock) {
+
+	Grid_Link *link = &grid->links[rock];
+	if (grid->cell[rock] < 0) return;
+	if (link->prev >= 0) grid->links[link->prev].next = link->next;
+	else grid->head[grid->cell[rock]] = link->next;
+	if (link->next >= 0) grid->links[link->next].prev = link->prev;
+	grid->cell[rock] = -1;
+}
+
+
+// Links an asteroid at the front of a cell //
+static void link_rock(Collision_Grid *grid, Sint32 rock, Sint32 cell) {
+
+	Grid_Link *link = &grid->links[rock];
+	grid->cell[rock] = cell;
+	if (cell < 0) return;
+	link->prev = -1;
+	link->next = grid->head[cell];
+	if (link->next >= 0) grid->links[link->next].prev = rock;
+	grid->head[cell] = rock;
+}
+
+
+// Moves an asteroid to a new cell //
+static void relink_rock(Collision_Grid *grid, Sint32 rock, Sint32 cell) {
+	unlink_rock(grid, rock);
+	link_rock(grid, rock, cell);
+}
+
+
+// Plain C kernel, also finishes the tail of the vector kernels //
+static void update_scalar(Collision_Grid *grid, const Asteroid_Field *rocks, size_t start) {
+
+	for (size_t i = start; i < rocks->count; ++i) {
+		Sint32 cell = cell_of(rocks->x[i], rocks->y[i], rocks->size[i]);
+		if (cell != grid->cell[i]) relink_rock(grid, i, cell);
+	}
+}
+
+
+#ifdef GRID_SSE2
+// Four asteroids per step, same rules as cell_of //
+static void update_sse2(Collision_Grid *grid, const Asteroid_Field *rocks, size_t start) {
+
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 width = _mm_set1_ps(WIDTH), height = _mm_set1_ps(HEIGHT);
+	const __m128 scale = _mm_set1_ps(1.0f / GRID_CELL), cols = _mm_set1_ps(GRID_COLS);
+	const __m128i outside = _mm_set1_epi32(-1);
+	size_t i = start;
+	for (; i + 4 <= rocks->count; i += 4) {
+		__m128 x = _mm_load_ps(rocks->x + i);
+		__m128 y = _mm_load_ps(rocks->y + i);
+		__m128 size = _mm_load_ps(rocks->size + i);
+		__m128 inside = _mm_and_ps(
+			_mm_and_ps(_mm_cmpgt_ps(_mm_add_ps(x, size), zero), _mm_cmplt_ps(x, width)),
+			_mm_and_ps(_mm_cmpgt_ps(_mm_add_ps(y, size), zero), _mm_cmplt_ps(y, height))
+		);
+		__m128i col = _mm_cvttps_epi32(_mm_mul_ps(_mm_max_ps(x, zero), scale));
+		__m128i row = _mm_cvttps_epi32(_mm_mul_ps(_mm_max_ps(y, zero), scale));
+		__m128i cell = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(row), cols), _mm_cvtepi32_ps(col)));
+		cell = _mm_or_si128(_mm_and_si128(_mm_castps_si128(inside), cell), _mm_andnot_si128(_mm_castps_si128(inside), outside));
+		__m128i old = _mm_loadu_si128((const __m128i *)(grid->cell + i));
+		int moved = ~_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(cell, old))) & 0xF;
+		if (!moved) continue;
+		Sint32 cells[4];
+		_mm_storeu_si128((__m128i *)cells, cell);
+		for (int lane = 0; moved; ++lane, moved >>= 1) {
+			if (moved & 1) relink_rock(grid, i + lane, cells[lane]);
+		}
+	}
+	update_scalar(grid, rocks, i);
+}
+#endif
+
+
+#ifdef GRID_AVX2
+// Eight asteroids per step, same rules as cell_of //
+__attribute__((target("avx2")))
+static void update_avx2(Collision_Grid *grid, const Asteroid_Field *rocks, size_t start) {
+
+	const __m256 zero = _mm256_setzero_ps();
+	const __m256 width = _mm256_set1_ps(WIDTH), height = _mm256_set1_ps(HEIGHT);
+	const __m256 scale = _mm256_set1_ps(1.0f / GRID_CELL);
+	const __m256i cols = _mm256_set1_epi32(GRID_COLS), outside = _mm256_set1_epi32(-1);
+	size_t i = start;
+	for (; i + 8 <= rocks->count; i += 8) {
+		__m256 x = _mm256_load_ps(rocks->x + i);
+		__m256 y = _mm256_load_ps(rocks->y + i);
+		__m256 size = _mm256_load_ps(rocks->size + i);
+		__m256 inside = _mm256_and_ps(
+			_mm256_and_ps(_mm256_cmp_ps(_mm256_add_ps(x, size), zero, _CMP_GT_OQ), _mm256_cmp_ps(x, width, _CMP_LT_OQ)),
+			_mm256_and_ps(_mm256_cmp_ps(_mm256_add_ps(y, size), zero, _CMP_GT_OQ), _mm256_cmp_ps(y, height, _CMP_LT_OQ))
+		);
+		__m256i col = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_max_ps(x, zero), scale));
+		__m256i row = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_max_ps(y, zero), scale));
+		__m256i cell = _mm256_add_epi32(_mm256_mullo_epi32(row, cols), col);
+		cell = _mm256_blendv_epi8(outside, cell, _mm256_castps_si256(inside));
+		__m256i old = _mm256_loadu_si256((const __m256i *)(grid->cell + i));
+		int moved = ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(cell, old))) & 0xFF;
+		if (!moved) continue;
+		Sint32 cells[8];
+		_mm256_storeu_si256((__m256i *)cells, cell);
+		for (int lane = 0; moved; ++lane, moved >>= 1) {
+			if (moved & 1) relink_rock(grid, i + lane, cells[lane]);
+		}
+	}
+	// avoid the AVX to SSE transition penalty in the scalar tail //
+	_mm256_zeroupper();
+	update_scalar(grid, rocks, i);
+}
+#endif
+
+
+// Picks the widest kernel this CPU supports //
+static Update_Kernel pick_kernel(void) {
+
+#ifdef GRID_AVX2
+	if (SDL_HasAVX2()) return update_avx2;
+#endif
+#ifdef GRID_SSE2
+	if (SDL_HasSSE2()) return update_sse2;
+#endif
+	return update_scalar;
+}
+
+
+// Arena space Collision_Grid_Create takes //
+size_t Collision_Grid_Footprint(size_t capacity) {
+	return ARENA_FOOTPRINT(sizeof(Collision_Grid)) +
+		ARENA_FOOTPRINT(capacity * sizeof(Grid_Link)) +
+		ARENA_FOOTPRINT(capacity * sizeof(Sint32));
+}
+
+
+// Create a grid for up to capacity asteroids //
+Collision_Grid *Collision_Grid_Create(Arena *arena, size_t capacity) {
+
+	Collision_Grid *grid = Arena_Alloc(arena, sizeof(Collision_Grid));
+	if (!grid) return NULL;
+	grid->capacity = capacity;
+	grid->links = Arena_Alloc(arena, capacity * sizeof(Grid_Link));
+	grid->cell = Arena_Alloc(arena, capacity * sizeof(Sint32));
+	if (!grid->links || !grid->cell) return NULL;
+	if (!update_kernel) update_kernel = pick_kernel();
+	Collision_Grid_Clear(grid);
+	return grid;
+}
+
+
+// Empties every cell //
+void Collision_Grid_Clear(Collision_Grid *grid) {
+
+	for (size_t i = 0; i < SDL_arraysize(grid->head); ++i) grid->head[i] = -1;
+	for (size_t i = 0; i < grid->capacity; ++i) grid->cell[i] = -1;
+}
+
+
+// Unfiles an asteroid, the next update files whatever is at its index again //
+void Collision_Grid_Remove(Collision_Grid *grid, Uint32 rock) {
+	unlink_rock(grid, rock);
+}
+
+
+// Relinks the asteroids that moved into a different cell //
+void Collision_Grid_Update(Collision_Grid *grid, const Asteroid_Field *rocks) {
+	update_kernel(grid, rocks, 0);
+}
+
+
+// Visits every asteroid that could overlap area //
+bool Collision_Grid_Query(const Collision_Grid *grid, const SDL_Rect *area, Grid_Visit visit, void *userdata) {
+
+	// one extra cell up and left catches asteroids filed there that reach into area //
+	int col0 = SDL_max(area->x < 0 ? 0 : area->x / GRID_CELL - 1, 0);
+	int row0 = SDL_max(area->y < 0 ? 0 : area->y / GRID_CELL - 1, 0);
+	int col1 = SDL_min((area->x + area->w - 1) / GRID_CELL, GRID_COLS - 1);
+	int row1 = SDL_min((area->y + area->h - 1) / GRID_CELL, GRID_ROWS - 1);
+	for (int row = row0; row <= row1; ++row) {
+		for (int col = col0; col <= col1; ++col) {
+			for (Sint32 rock = grid->head[row * GRID_COLS + col]; rock >= 0; rock = grid->links[rock].next) {
+				if (visit(rock, userdata)) return true;
+			}
+		}
+	}
+	return false;
+}
+
+
+// Tests one asteroid against every asteroid in a cell //
+static size_t test_cell(const Collision_Grid *grid, const Asteroid_Field *rocks, Sint32 a, Sint32 first, Grid_Pair pair, void *userdata) {
+
+	size_t hits = 0;
+	for (Sint32 b = first; b >= 0; b = grid->links[b].next) {
+		if (
+			rocks->x[a] < rocks->x[b] + rocks->size[b] && rocks->x[b] < rocks->x[a] + rocks->size[a] &&
+			rocks->y[a] < rocks->y[b] + rocks->size[b] && rocks->y[b] < rocks->y[a] + rocks->size[a]
+		) {
+			if (pair) pair(a, b, userdata);
+			++hits;
+		}
+	}
+	return hits;
+}
+
+
+// Reports each overlapping pair of asteroids once, returns the number of pairs, pair may be NULL //
+size_t Collision_Grid_Pairs(const Collision_Grid *grid, const Asteroid_Field *rocks, Grid_Pair pair, void *userdata) {
+
+	// same cell, then right, below-left, below and below-right covers each pair once //
+	static const int neighbours[4][2] = {{0, 1}, {1, -1}, {1, 0}, {1, 1}};
+	size_t hits = 0;
+	for (int row = 0; row < GRID_ROWS; ++row) {
+		for (int col = 0; col < GRID_COLS; ++col) {
+			for (Sint32 a = grid->head[row * GRID_COLS + col]; a >= 0; a = grid->links[a].next) {
+				hits += test_cell(grid, rocks, a, grid->links[a].next, pair, userdata);
+				for (int n = 0; n < 4; ++n) {
+					int r = row + neighbours[n][0], c = col + neighbours[n][1];
+					if (r >= GRID_ROWS || c < 0 || c >= GRID_COLS) continue;
+					hits += test_cell(grid, rocks, a, grid->head[r * GRID_COLS + c], pair, userdata);
+				}
+			}
+		}
+	}
+	return hits;
+}
@@ -0,0 +1,58 @@
+///////////////////////////|
+//|File: grid.h
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+//----------------------------------------------------------------
+
+#ifndef GRID_H
+#define GRID_H
+
+#include <stdbool.h>
+
+#include "arena.h"
+#include "asteroids.h"
+#include "shared.h"
+
+// Cell size in pixels, no asteroid may be bigger than a cell //
+#define GRID_CELL 16
+#define GRID_COLS ((WIDTH + GRID_CELL - 1) / GRID_CELL)
+#define GRID_ROWS ((HEIGHT + GRID_CELL - 1) / GRID_CELL)
+
+// Links between asteroids sharing a cell //
+typedef struct {
+	Sint32 next, prev;
+} Grid_Link;
+
+// Uniform grid over the playfield, each asteroid is filed under its top-left cell //
+typedef struct {
+	Sint32 head[GRID_ROWS * GRID_COLS];	// first asteroid in each cell, -1 when empty
+	Grid_Link *links;					// one link per asteroid
+	Sint32 *cell;						// cell each asteroid is filed under, -1 when off the playfield
+	size_t capacity;					// asteroids the grid has room for
+} Collision_Grid;
+
+// Called for each candidate, return true to stop the query //
+typedef bool (*Grid_Visit)(Uint32 rock, void *userdata);
+
+// Called for each pair of overlapping asteroids //
+typedef void (*Grid_Pair)(Uint32 a, Uint32 b, void *userdata);
+
+size_t Collision_Grid_Footprint(size_t capacity);
+
+Collision_Grid *Collision_Grid_Create(Arena *arena, size_t capacity);
+
+void Collision_Grid_Clear(Collision_Grid *grid);
+
+void Collision_Grid_Remove(Collision_Grid *grid, Uint32 rock);
+
+void Collision_Grid_Update(Collision_Grid *grid, const Asteroid_Field *rocks);
+
+bool Collision_Grid_Query(const Collision_Grid *grid, const SDL_Rect *area, Grid_Visit visit, void *userdata);
+
+size_t Collision_Grid_Pairs(const Collision_Grid *grid, const Asteroid_Field *rocks, Grid_Pair pair, void *userdata);
+
+#endif
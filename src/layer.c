@@ -0,0 +1,98 @@
+///////////////////////////|
+//|File: layer.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Caches screens and panels that do not change from frame to frame.
+ * A layer is drawn once into a render target and then copied with a
+ * single call, which matters on the software renderer where every
+ * blit is CPU work. Without render targets the layer is drawn directly.
+ */
+
+//----------------------------------------------------------------
+
+// SDL2 //
+#include <SDL2/SDL.h>
+
+// Header Files //
+#include "layer.h"
+
+
+// Create layer, its contents are drawn on the first render //
+Layer *Layer_Create(SDL_Renderer *renderer, SDL_Rect bounds, bool opaque, Layer_Draw *draw, void *userdata) {
+
+	Layer *layer = SDL_malloc(sizeof(Layer));
+	if (!layer) {
+		SDL_SetError("Failed to allocate memory for layer.");
+		return NULL;
+	}
+	*layer = (Layer) {
+		.bounds = bounds,
+		.opaque = opaque,
+		.draw = draw,
+		.userdata = userdata
+	};
+	if (SDL_RenderTargetSupported(renderer)) {
+		layer->texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, bounds.w, bounds.h);
+		if (layer->texture) SDL_SetTextureBlendMode(layer->texture, opaque ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
+	}
+	return layer;
+}
+
+
+// Destroy layer //
+void Layer_Destroy(Layer *layer) {
+	if (!layer) return;
+	if (layer->texture) SDL_DestroyTexture(layer->texture);
+	SDL_free(layer);
+}
+
+
+// Contents changed, they are drawn again on the next render //
+void Layer_Invalidate(Layer *layer) {
+	layer->valid = false;
+}
+
+
+// Draws the contents into the layer's texture //
+static bool redraw(Layer *layer, SDL_Renderer *renderer) {
+
+	SDL_Texture *prev_target = SDL_GetRenderTarget(renderer);
+	if (SDL_SetRenderTarget(renderer, layer->texture) < 0) return false;
+	Uint8 r, g, b, a;
+	SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+	SDL_SetRenderDrawColor(renderer, 0, 0, 0, layer->opaque ? 255 : 0);
+	SDL_RenderClear(renderer);
+	SDL_SetRenderDrawColor(renderer, r, g, b, a);
+	layer->draw(renderer, layer->userdata);
+	SDL_SetRenderTarget(renderer, prev_target);
+	return true;
+}
+
+
+// Copies the cached layer, drawing it first if it was invalidated //
+void Layer_Render(Layer *layer, SDL_Renderer *renderer) {
+
+	if (layer->texture && !layer->valid) {
+		layer->valid = redraw(layer, renderer);
+		if (!layer->valid) {
+			// render targets failed, draw directly from now on //
+			SDL_DestroyTexture(layer->texture);
+			layer->texture = NULL;
+		}
+	}
+	if (layer->texture) {
+		SDL_RenderCopy(renderer, layer->texture, NULL, &layer->bounds);
+		return;
+	}
+	SDL_Rect viewport;
+	SDL_RenderGetViewport(renderer, &viewport);
+	SDL_RenderSetViewport(renderer, &layer->bounds);
+	layer->draw(renderer, layer->userdata);
+	SDL_RenderSetViewport(renderer, &viewport);
+}
@@ -0,0 +1,37 @@
+///////////////////////////|
+//|File: layer.h
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+//----------------------------------------------------------------
+
+#ifndef LAYER_H
+#define LAYER_H
+
+#include <stdbool.h>
+
+// Draws a layer's contents, coordinates are relative to the layer's top-left //
+typedef void Layer_Draw(SDL_Renderer *renderer, void *userdata);
+
+// Static composite kept in a render target and copied with one call until invalidated //
+typedef struct {
+	SDL_Texture *texture;	// cached contents, NULL when render targets are unavailable
+	SDL_Rect bounds;		// where the layer goes on screen
+	bool opaque;			// covers its whole area, so it is copied without blending
+	bool valid;				// texture holds the current contents
+	Layer_Draw *draw;
+	void *userdata;
+} Layer;
+
+Layer *Layer_Create(SDL_Renderer *renderer, SDL_Rect bounds, bool opaque, Layer_Draw *draw, void *userdata);
+
+void Layer_Destroy(Layer *layer);
+
+void Layer_Invalidate(Layer *layer);
+
+void Layer_Render(Layer *layer, SDL_Renderer *renderer);
+
+#endif
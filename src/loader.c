@@ -0,0 +1,151 @@
+///////////////////////////|
+//|File: loader.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Decodes images and sounds on worker threads so the window can show
+ * while assets are still loading. Textures are never touched here, the
+ * render thread uploads finished surfaces itself.
+ */
+
+//----------------------------------------------------------------
+
+// SDL2 //
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+
+// Header Files //
+#include "assets.h"
+#include "loader.h"
+
+
+// Decodes one job //
+static void load(Load_Job *job) {
+
+	bool loaded;
+	if (job->type == ASSET_SOUND) {
+		job->chunk = Assets_LoadWAV(job->path);
+		loaded = job->chunk != NULL;
+	} else {
+		job->surface = Assets_LoadBMP(job->path);
+		loaded = job->surface != NULL;
+	}
+	if (!loaded) SDL_strlcpy(job->error, SDL_GetError(), sizeof(job->error));
+	SDL_AtomicSet(&job->state, loaded ? LOAD_DONE : LOAD_FAILED);
+}
+
+
+// Worker thread, runs until the loader is destroyed and the queue is empty //
+static int worker(void *data) {
+
+	Loader *loader = data;
+	SDL_LockMutex(loader->lock);
+	for (;;) {
+		while (!loader->head && !loader->quit) SDL_CondWait(loader->work, loader->lock);
+		Load_Job *job = loader->head;
+		if (!job) break;
+		loader->head = job->next;
+		if (!loader->head) loader->tail = NULL;
+		SDL_UnlockMutex(loader->lock);
+
+		load(job);
+
+		SDL_LockMutex(loader->lock);
+		SDL_CondBroadcast(loader->done);
+	}
+	SDL_UnlockMutex(loader->lock);
+	return 0;
+}
+
+
+// Create loader and start its workers //
+Loader *Loader_Create(int threads) {
+
+	if (threads < 1) threads = 1;
+	if (threads > LOADER_MAX_THREADS) threads = LOADER_MAX_THREADS;
+	Loader *loader = SDL_malloc(sizeof(Loader));
+	if (!loader) {
+		SDL_SetError("Failed to allocate memory for loader.");
+		return NULL;
+	}
+	*loader = (Loader) {
+		.lock = SDL_CreateMutex(),
+		.work = SDL_CreateCond(),
+		.done = SDL_CreateCond()
+	};
+	if (!loader->lock || !loader->work || !loader->done) {
+		Loader_Destroy(loader);
+		return NULL;
+	}
+	for (int i = 0; i < threads; ++i) {
+		SDL_Thread *thread = SDL_CreateThread(worker, "loader", loader);
+		if (!thread) break;
+		loader->threads[loader->thread_count++] = thread;
+	}
+	if (loader->thread_count == 0) {
+		Loader_Destroy(loader);
+		return NULL;
+	}
+	return loader;
+}
+
+
+// Destroy loader, queued jobs are finished first //
+void Loader_Destroy(Loader *loader) {
+
+	if (!loader) return;
+	if (loader->lock) {
+		SDL_LockMutex(loader->lock);
+		loader->quit = true;
+		SDL_CondBroadcast(loader->work);
+		SDL_UnlockMutex(loader->lock);
+	}
+	for (int i = 0; i < loader->thread_count; ++i) SDL_WaitThread(loader->threads[i], NULL);
+	SDL_DestroyCond(loader->done);
+	SDL_DestroyCond(loader->work);
+	SDL_DestroyMutex(loader->lock);
+	SDL_free(loader);
+}
+
+
+// Queues a job, it is decoded in the order it was queued //
+void Loader_Queue(Loader *loader, Load_Job *job) {
+
+	SDL_AtomicSet(&job->state, LOAD_PENDING);
+	job->surface = NULL;
+	job->chunk = NULL;
+	job->next = NULL;
+	SDL_LockMutex(loader->lock);
+	if (loader->tail) loader->tail->next = job;
+	else loader->head = job;
+	loader->tail = job;
+	SDL_CondSignal(loader->work);
+	SDL_UnlockMutex(loader->lock);
+}
+
+
+// Whether a job has finished, never blocks //
+bool Load_Job_Ready(Load_Job *job) {
+	return SDL_AtomicGet(&job->state) != LOAD_PENDING;
+}
+
+
+// Blocks until a job has finished, returns false with the SDL error set if it failed //
+bool Load_Job_Wait(Loader *loader, Load_Job *job) {
+
+	if (!Load_Job_Ready(job)) {
+		SDL_LockMutex(loader->lock);
+		while (!Load_Job_Ready(job)) SDL_CondWait(loader->done, loader->lock);
+		SDL_UnlockMutex(loader->lock);
+	}
+	if (SDL_AtomicGet(&job->state) == LOAD_FAILED) {
+		SDL_SetError("%s", job->error);
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,55 @@
+///////////////////////////|
+//|File: loader.h
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+//----------------------------------------------------------------
+
+#ifndef LOADER_H
+#define LOADER_H
+
+#include <stdbool.h>
+
+// Job states //
+#define LOAD_PENDING 0
+#define LOAD_DONE 1
+#define LOAD_FAILED 2
+
+#define LOADER_MAX_THREADS 4
+
+// One image or sound to decode, the caller keeps it alive until it is waited on //
+typedef struct Load_Job {
+	const char *path;			// file to load
+	Uint32 type;				// ASSET_IMAGE or ASSET_SOUND
+	SDL_atomic_t state;			// LOAD_PENDING until a worker finishes it
+	SDL_Surface *surface;		// decoded image, owned by the caller once done
+	struct Mix_Chunk *chunk;	// decoded sound, owned by the caller once done
+	char error[128];			// SDL error when the load failed
+	struct Load_Job *next;		// queue link
+} Load_Job;
+
+// Worker threads decoding queued jobs in order //
+typedef struct {
+	SDL_Thread *threads[LOADER_MAX_THREADS];
+	int thread_count;
+	SDL_mutex *lock;
+	SDL_cond *work;				// signalled when a job is queued
+	SDL_cond *done;				// signalled when a job finishes
+	Load_Job *head, *tail;		// jobs no worker has taken yet
+	bool quit;
+} Loader;
+
+Loader *Loader_Create(int threads);
+
+void Loader_Destroy(Loader *loader);
+
+void Loader_Queue(Loader *loader, Load_Job *job);
+
+bool Load_Job_Ready(Load_Job *job);
+
+bool Load_Job_Wait(Loader *loader, Load_Job *job);
+
+#endif
@@ -17,6 +17,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
 #include <time.h>
 
 // SDL2 //
@@ -24,97 +25,257 @@
 #include <SDL2/SDL_mixer.h>
 
 // Header Files //
+#include "atlas.h"
 #include "tilesheet.h"
 #include "font.h"
 #include "ship.h"
+#include "game.h"
+#include "quad.h"
+#include "assets.h"
+#include "loader.h"
+#include "profiler.h"
+#include "replay.h"
+#include "pacer.h"
+#include "layer.h"
+#include "sound.h"
+#include "scores.h"
+#include "particles.h"
+#include "simulation.h"
+#include "pool.h"
+#include "bot.h"
+#include "softfb.h"
 #include "shared.h"
 
 // Defines //
-#define TOTAL_ROCKS 15
-#define ASTEROID_ACCEL 2
 #define TITLE_SCALE 3
 #define GAME_OVER_SCALE 2
 #define BG_VELOCITY 100
+#define ATLAS_WIDTH 256		// fits the background with the sprites and font on a shelf below it
+#define ATLAS_HEIGHT 512
+#define LOADER_THREADS 2
+#define IDLE_TIMEOUT 100	// ms a static screen sleeps waiting for input
+#define FALLBACK_FPS 60		// cap when vsync is unavailable and the display rate is unknown
+#define HEADLESS_TICKS 10000000
+#define MAX_FRAME_TIME 0.25	// longest frame fed to the simulation, in seconds
+#define AUDIO_BUFFER 512		// frames per audio callback, about 11 ms at 48 kHz
+#define EXPLOSION_PARTICLES 512	// debris thrown out when the ship is hit
+#define EXPLOSION_SPEED 90		// fastest debris, pixels per second
+#define SOFTWARE_PARTICLES 2048	// most particles drawn per frame when the renderer rasterizes on the CPU
+#define BATCH_MAX_SECONDS 600	// a bot game still going after this long counts as survived
+#define BATCH_BUCKETS 10		// score histogram rows
+#define BATCH_BAR 40			// widest histogram bar, in characters
+#define INPUT_PROBES 32			// direction changes waiting to be seen on screen by the latency probe
 
-// Asteroid Struct //
-struct Asteroid {
-    float x,y;		// x and y position of asteroid
-    float velocity;	// Speed which the asteroid move
-    int size;		// Size of the asteroid
-};
-
-// player and asteroids //
-static struct Asteroid rocks[TOTAL_ROCKS];
+// player and asteroids, the game is stepped on the simulation thread while playing //
+static Game *game;
+static Simulation *sim;
 static Space_Ship *player;
-static Mix_Chunk *intro, *points, *boom;
+static Sound *intro, *points, *boom;
 
 // Renderer instance //
 static SDL_Renderer *renderer;
 
+// Every image shares the atlas texture //
+static Atlas *atlas;
+
+// Playfield composed on the CPU, NULL when the renderer draws it //
+static Soft_Frame *frame;
+static bool softfb = false;
+
 // Font //
 static Font *font;
 
-// Background //
-static SDL_Texture *bg;
+// Background, title and game over images, explosion frames //
+static TileSheet *bg, *title_card, *game_over_card, *explosion;
+
+// Assets decoded in the background, the title card and font are queued first //
+static Loader *loader;
+static Load_Job title_job = {.path = "Images/title.bmp", .type = ASSET_IMAGE};
+static Load_Job font_job = {.path = "Images/font.bmp", .type = ASSET_IMAGE};
+static Load_Job ship_job = {.path = "Images/ship.bmp", .type = ASSET_IMAGE};
+static Load_Job bg_job = {.path = "Images/space.bmp", .type = ASSET_IMAGE};
+static Load_Job game_over_job = {.path = "Images/game.bmp", .type = ASSET_IMAGE};
+static Load_Job explosion_job = {.path = "Images/Explodie.bmp", .type = ASSET_IMAGE};
+static Load_Job intro_job = {.path = "Music/Sounds/intro.wav", .type = ASSET_SOUND};
+static Load_Job points_job = {.path = "Music/Sounds/points.wav", .type = ASSET_SOUND};
+static Load_Job boom_job = {.path = "Music/Sounds/boom.wav", .type = ASSET_SOUND};
+
+// Asteroid draw batch //
+static Quad_Batch *rock_batch;
+
+// Explosion debris, drawn in one batch, the budget limits it on software renderers //
+static Particle_System *particles;
+static Quad_Batch *particle_batch;
+static Uint32 particle_budget = 0;
 
 // Score //
 Sint32 high_score = 0;
+static Leaderboard leaderboard;
+static Score_Writer *score_writer;
+
+// Simulation steps per second //
+static int tick_rate = DEFAULT_TICK_RATE;
 
+// Asteroids in play, stress runs never end on a hit //
+static size_t rock_count = TOTAL_ROCKS;
+static bool stress = false;
 
-// Initialize the player and asteroids //
+// Profiler overlay, and where to write the trace on exit //
+static bool show_profiler = false;
+static const char *trace_path = NULL;
+
+// Every game's seed is drawn from the session seed, so a session replays from it //
+static Uint64 session_seed;
+static Uint64 session_rng;
+static Uint32 session_tick;		// steps simulated since the session started
+static Replay *recording;
+static const char *record_path = NULL;
+
+// Frame pacing, a cap of -1 picks one from the display when vsync is off //
+static bool vsync = true;
+static int fps_cap = -1;
+static Frame_Pacer pacer;
+
+// Audio callback size, smaller buffers hear effects sooner //
+static int audio_buffer = AUDIO_BUFFER;
+
+
+// Starts a new game on the simulation with the next seed //
 static void init(void) {
 
-	Mix_PlayChannel(1, intro, 0);
-    	Space_Ship_Reset(player);
-    	for (size_t i = 0; i < TOTAL_ROCKS; ++i) {
-			rocks[i] = (struct Asteroid) {
-            	.velocity = rand() % 100 + 50,
-           	 	.size = rand() % 5 + 5 // range from 5-15
-       		 };
-        rocks[i].x = rand() % (WIDTH - rocks[i].size);
-        rocks[i].y = -(rand() % HEIGHT) - rocks[i].size;
-		}
+	Sound_Play(intro);
+	Particle_System_Clear(particles);
+	Simulation_Send(sim, SIM_RESET, 0, Game_Random(&session_rng));
 }
 
 
-// Draws asteroids //
-static void draw_rock(void) {
+// Blends the previous and current simulation step //
+static float lerp(float prev, float cur, float alpha) {
+	return prev + (cur - prev) * alpha;
+}
 
-	SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-	for (size_t i = 0; i < TOTAL_ROCKS; ++i) {
-        SDL_Rect rock = {
-            .x = rocks[i].x,
-            .y = rocks[i].y,
-            .w = rocks[i].size,
-            .h = rocks[i].size
-        };
-        SDL_RenderFillRect(renderer, &rock);
-    }
+
+// Draws asteroids in one batch, solid quads sample white from the atlas //
+static void draw_rock(const Snapshot *snapshot, float alpha) {
+
+	const Uint64 zone = Profiler_Begin();
+	Quad_Batch_Clear(rock_batch);
+	Snapshot_Draw(snapshot, rock_batch, &atlas->white, alpha);
+	if (frame) Soft_Frame_DrawBatch(frame, rock_batch);
+	else Quad_Batch_Render(rock_batch, renderer, atlas->texture);
+	Profiler_End(PROFILE_ROCKS, zone);
+}
+
+
+// Moves the explosion debris and draws it in one batch //
+static void update_particles(float delta_t, const SDL_FRect frames[PARTICLE_FRAMES]) {
+
+	const Uint64 zone = Profiler_Begin();
+	Particle_System_Update(particles, delta_t);
+	Quad_Batch_Clear(particle_batch);
+	Particle_System_Draw(particles, particle_batch, frames, particle_budget);
+	if (frame) Soft_Frame_DrawBatch(frame, particle_batch);
+	else Quad_Batch_Render(particle_batch, renderer, atlas->texture);
+	Profiler_End(PROFILE_PARTICLES, zone);
+}
+
+
+// Adds a game to the leaderboard, the file is written in the background //
+static void submit_score(Uint64 score) {
+
+	// stress runs cannot be lost, so they are not real games //
+	if (score == 0 || stress) return;
+	if (Leaderboard_Add(&leaderboard, score, time(NULL)) < 0) return;
+	if (score_writer) Score_Writer_Submit(score_writer, &leaderboard);
+	else if (!Leaderboard_Save(&leaderboard, SCORES_FILE)) fprintf(stderr, "Could not save scores: %s\n", SDL_GetError());
 }
 
 
-// High Score //
-static Sint32 get_hscore(void) {
+// Copies a loaded image into the atlas, NULL while it is still loading //
+static TileSheet *upload_image(Load_Job *job, bool wait, int tile_width, int tile_height, int flags) {
 
-    FILE *fptr = fopen("scores", "r");
-    if (!fptr) return 0;
-    Uint32 hs = 0;
-    fread(&hs, sizeof(hs), 1, fptr);
-    fclose(fptr);
-    return hs;
+	if (!wait && !Load_Job_Ready(job)) return NULL;
+	TileSheet *tiles = NULL;
+	if (Load_Job_Wait(loader, job)) {
+		// packed images come with the color key already in their alpha //
+		if (Assets_HasImage(job->path)) flags |= TILESHEET_KEYED;
+		tiles = TileSheet_createFromSurfaceInAtlas(job->surface, atlas, tile_width, tile_height, flags | TILESHEET_FREESURFACE);
+		job->surface = NULL;
+	}
+	if (!tiles) {
+		fprintf(stderr, "Could not load %s: %s\n", job->path, SDL_GetError());
+		exit(1);
+	}
+	return tiles;
 }
 
 
-static void set_hscore(Sint32 score) {
+// Takes a loaded sound, NULL while it is still loading //
+static Sound *take_sound(Load_Job *job, bool wait, int max_voices, int priority) {
 
-    FILE *fptr = fopen("scores", "w");
-    if (!fptr) return;
-    Uint32 hs = 0;
-    if (fread(&hs, sizeof(hs), 1, fptr) == 0 || score > hs) {
-        rewind(fptr);
-        fwrite(&score, sizeof(score), 1, fptr);
-    }
-    fclose(fptr);
+	if (!wait && !Load_Job_Ready(job)) return NULL;
+	if (!Load_Job_Wait(loader, job)) {
+		fprintf(stderr, "Could not load %s: %s\n", job->path, SDL_GetError());
+		exit(1);
+	}
+	Sound *sound = Sound_Create(job->chunk, max_voices, priority);
+	if (!sound) {
+		fprintf(stderr, "Could not create sound: %s\n", SDL_GetError());
+		exit(1);
+	}
+	return sound;
+}
+
+
+// Picks up whatever the loader has finished, waits for the rest when asked //
+static void load_assets(bool wait) {
+
+	if (!player) {
+		TileSheet *tiles = upload_image(&ship_job, wait, SHIP_WIDTH, SHIP_HEIGHT, TILESHEET_CREATEMASK);
+		if (tiles && !(player = Space_Ship_Create(tiles))) {
+			fprintf(stderr, "Could not create ship: %s\n", SDL_GetError());
+			exit(1);
+		}
+		if (player) Game_SetShipMask(game, TileSheet_getTileMask(player->tiles, 0));
+	}
+	if (!bg) bg = upload_image(&bg_job, wait, 0, 0, 0);
+	if (!game_over_card) game_over_card = upload_image(&game_over_job, wait, 0, 0, 0);
+	if (!explosion) explosion = upload_image(&explosion_job, wait, 8, 8, 0);
+	// a hit outranks the points chime when every voice is busy //
+	if (!intro) intro = take_sound(&intro_job, wait, 1, 2);
+	if (!points) points = take_sound(&points_job, wait, 4, 0);
+	if (!boom) boom = take_sound(&boom_job, wait, 2, 1);
+}
+
+
+// Title card and prompt, drawn once into a layer //
+struct Title_Screen {
+	SDL_Rect src, dst;		// title card in the atlas and on screen
+	SDL_Point text_point;
+	const char *text;
+};
+
+
+static void draw_title(SDL_Renderer *renderer, void *userdata) {
+	const struct Title_Screen *title = userdata;
+	SDL_RenderCopy(renderer, title_card->texture, &title->src, &title->dst);
+	Font_renderText(font, renderer, &title->text_point, title->text);
+}
+
+
+// Game over card and the final scores, drawn once per game over //
+struct Game_Over_Panel {
+	SDL_Rect src, dst;		// game over card in the atlas and on screen
+	SDL_Point high_score_point;
+	Uint64 score;
+};
+
+
+static void draw_game_over(SDL_Renderer *renderer, void *userdata) {
+	const struct Game_Over_Panel *panel = userdata;
+	SDL_RenderCopy(renderer, game_over_card->texture, &panel->src, &panel->dst);
+	Font_renderFormatted(font, renderer, NULL, "SCORE\n%llu", (unsigned long long)panel->score);
+	Font_renderFormatted(font, renderer, &panel->high_score_point, "HIGH SCORE\n%010d", high_score);
 }
 
 
@@ -122,11 +283,16 @@ static void set_hscore(Sint32 score) {
 static void title_screen(void) {
 
 	bool quit = false, title = true;
-	SDL_Surface *surface = SDL_LoadBMP("Images/title.bmp");
-	SDL_Texture *texture = SDL_CreateTextureFromSurface(renderer, surface);
-	SDL_FreeSurface(surface);
-	int tex_w, tex_h;
-	SDL_QueryTexture(texture, NULL, NULL, &tex_w, &tex_h);
+
+	// only the title card and font are needed to show the first frame //
+	title_card = upload_image(&title_job, true, 0, 0, 0);
+	font = Font_createFromTileSheet(upload_image(&font_job, true, 8, 8, 0), 1);
+	if (!font) {
+	    fprintf(stderr, "Could not load font: %s\n", SDL_GetError());
+	    exit(1);
+	}
+	const SDL_Rect title_src = TileSheet_getTileRect(title_card, 0);
+	const int tex_w = title_src.w, tex_h = title_src.h;
 	const SDL_Rect title_rect = {
 		.x = WIDTH / 2 - tex_w * TITLE_SCALE / 2,
 		.y = HEIGHT / 3 - tex_h * TITLE_SCALE / 2,
@@ -139,13 +305,25 @@ static void title_screen(void) {
 		.x = WIDTH / 2 - title_text_len * 4,
 		.y = HEIGHT / 2
 	};
+
+	// the whole screen is static, so it is one opaque layer //
+	struct Title_Screen screen = {title_src, title_rect, text_point, title_text};
+	Layer *layer = Layer_Create(renderer, (SDL_Rect) {0, 0, WIDTH, HEIGHT}, true, draw_title, &screen);
+	if (!layer) {
+		fprintf(stderr, "Could not create title screen: %s\n", SDL_GetError());
+		exit(1);
+	}
 	while (!quit && title) {
+		// nothing moves here, so sleep until there is input or the loader needs checking //
 		SDL_Event e;
-		while (SDL_PollEvent(&e)) {
+		for (int pending = SDL_WaitEventTimeout(&e, IDLE_TIMEOUT); pending; pending = SDL_PollEvent(&e)) {
 			switch (e.type) {
 				case SDL_QUIT: {
 					quit = true;
 				} break;
+				case SDL_RENDER_TARGETS_RESET: {
+					Layer_Invalidate(layer);
+				} break;
 				case SDL_KEYDOWN: {
 					switch (e.key.keysym.sym) {
 						case SDLK_ESCAPE: {
@@ -158,55 +336,133 @@ static void title_screen(void) {
 				} break;
 			}
 		}
-		SDL_RenderClear(renderer);
-		SDL_RenderCopy(renderer, texture, NULL, &title_rect);
-		Font_renderText(font, renderer, &text_point, title_text);
+		load_assets(false);
+		Layer_Render(layer, renderer);
 		SDL_RenderPresent(renderer);
+		Frame_Pacer_Wait(&pacer);
 	}
-	SDL_DestroyTexture(texture);
+	Layer_Destroy(layer);
 	if (quit) exit(0);
+	load_assets(true);
 }
 
 
-// Game physics //
-static void physics(Uint64 delta_t) {
+// Renders Background //
+static void render_bg(int pos) {
+	const Uint64 zone = Profiler_Begin();
+	SDL_Rect bg_rect[2] = {
+		{.x = 0, .y = pos - HEIGHT, .w = WIDTH, .h = HEIGHT},
+		{.x = 0, .y = pos, .w = WIDTH, .h = HEIGHT}
+	};
+	const SDL_Rect bg_src = TileSheet_getTileRect(bg, 0);
+	if (frame) {
+		// the background covers the playfield, so it also clears the frame //
+		Soft_Frame_Copy(frame, &bg_src, bg_rect);
+		Soft_Frame_Copy(frame, &bg_src, bg_rect + 1);
+	} else {
+		SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+		SDL_RenderClear(renderer);
+		SDL_RenderCopy(renderer, bg->texture, &bg_src, bg_rect);
+		SDL_RenderCopy(renderer, bg->texture, &bg_src, bg_rect + 1);
+	}
+	Profiler_End(PROFILE_BACKGROUND, zone);
+}
 
-	player->position += player->direction * SHIP_VELOCITY * (delta_t / 1000.0f);
-	if (player->position < 0) player->position = 0;
-	else if (player->position > WIDTH - player->tiles->tile_width) player->position = WIDTH - player->tiles->tile_width;
-	for (size_t i = 0; i < TOTAL_ROCKS; ++i) {
-		rocks[i].y += rocks[i].velocity * (delta_t / 1000.0f);
-		rocks[i].velocity += ASTEROID_ACCEL * (delta_t / 1000.0f);
-		if (rocks[i].y > HEIGHT) {
-			rocks[i].y = -rocks[i].size;
-			rocks[i].x = rand() % (WIDTH - rocks[i].size);
-		}
+
+// Draws the player ship //
+static void render_ship(float position) {
+	const Uint64 zone = Profiler_Begin();
+	if (frame) {
+		const SDL_Rect src = TileSheet_getTileRect(player->tiles, 0);
+		const SDL_Rect dst = {position, SHIP_Y, SHIP_WIDTH, SHIP_HEIGHT};
+		Soft_Frame_Blit(frame, &src, &dst);
+	} else {
+		Space_Ship_Render(player, renderer, position);
 	}
+	Profiler_End(PROFILE_SHIP, zone);
 }
 
 
-// Collisions //
-static bool collision(void) {
-	SDL_Rect ship_rect = {player->position, HEIGHT - 25, player->tiles->tile_width, player->tiles->tile_height};
-	for (size_t i = 0; i < TOTAL_ROCKS; ++i) {
-		SDL_Rect rock_rect = {rocks[i].x, rocks[i].y, rocks[i].size, rocks[i].size};
-		if (SDL_HasIntersection(&ship_rect, &rock_rect)) {
-			Mix_PlayChannel(-1, boom, 0);
-			return true;
-		}
+// Uploads the composed playfield, everything after this is drawn by the renderer //
+static void present_frame(void) {
+	if (!frame) return;
+	const Uint64 zone = Profiler_Begin();
+	if (!Soft_Frame_Present(frame, renderer)) fprintf(stderr, "Could not upload frame: %s\n", SDL_GetError());
+	Profiler_End(PROFILE_UPLOAD, zone);
+}
+
+
+// Renders score and high score, text is only laid out again when it changes //
+static void render_hud(CachedText *score_text, CachedText *high_score_text, Uint64 score) {
+	const Uint64 zone = Profiler_Begin();
+	CachedText_setFormatted(score_text, "SCORE\n%llu", (unsigned long long)score);
+	CachedText_setFormatted(high_score_text, "HIGH SCORE\n%010d", high_score);
+	if (frame) {
+		Soft_Frame_DrawBatch(frame, CachedText_getBatch(score_text));
+		Soft_Frame_DrawBatch(frame, CachedText_getBatch(high_score_text));
+	} else {
+		CachedText_render(score_text, renderer);
+		CachedText_render(high_score_text, renderer);
 	}
-	return false;
+	Profiler_End(PROFILE_TEXT, zone);
 }
 
 
-// Renders Background //
-static void render_bg(int pos) {
-	SDL_Rect bg_rect[2] = {
-		{.x = 0, .y = pos - HEIGHT, .w = WIDTH, .h = HEIGHT},
-		{.x = 0, .y = pos, .w = WIDTH, .h = HEIGHT}
-	};
-	SDL_RenderCopy(renderer, bg, NULL, bg_rect);
-	SDL_RenderCopy(renderer, bg, NULL, bg_rect + 1);
+// Audio latency under the profiler overlay //
+static void render_audio_stats(void) {
+	Sound_Stats stats;
+	Sound_GetStats(&stats);
+	const SDL_Point point = {0, 16 + 8 * (PROFILE_ZONES + 2)};
+	Font_renderFormatted(
+		font, renderer, &point, "AUDIO %5.2f %5.2f +%.1f\nVOICES %u LATE %u STOLEN %u",
+		stats.average_ms, stats.max_ms, stats.buffer_ms, stats.played, stats.dropped, stats.stolen
+	);
+}
+
+
+// Ship controls, and the direction changes the latency probe is waiting to see presented //
+struct Controls {
+	bool left, right;				// held, from key events and checked against the keyboard state each frame
+	int direction;					// last sent to the simulation
+	Uint32 sent;					// direction changes sent, the simulation counts the same ones
+	Uint32 head, tail;
+	struct {
+		Uint32 input;				// sent count once this change went out
+		Uint64 time;
+	} probes[INPUT_PROBES];
+};
+
+
+// Performance counter value when an event happened, SDL stamps events in milliseconds //
+static Uint64 event_time(Uint32 timestamp, Uint32 ticks, Uint64 now) {
+	const Uint64 age = (Uint64)(Uint32)(ticks - timestamp) * SDL_GetPerformanceFrequency() / 1000;
+	return age < now ? now - age : now;
+}
+
+
+// Sends the direction the held keys ask for if it changed, probe times it to the screen //
+static void steer(struct Controls *controls, Uint64 time, bool probe) {
+
+	const int direction = controls->right - controls->left;
+	if (direction == controls->direction || !Simulation_SendInput(sim, direction, time)) return;
+	controls->direction = direction;
+	++controls->sent;
+	if (!probe) return;
+	// the oldest is dropped when too many are in flight //
+	if (controls->head - controls->tail == INPUT_PROBES) ++controls->tail;
+	controls->probes[controls->head % INPUT_PROBES].input = controls->sent;
+	controls->probes[controls->head % INPUT_PROBES].time = time;
+	++controls->head;
+}
+
+
+// Reports every probed change that the step on screen had applied //
+static void probe_presented(struct Controls *controls, Uint32 shown, Uint64 presented) {
+	for (; controls->tail != controls->head; ++controls->tail) {
+		const int i = controls->tail % INPUT_PROBES;
+		if ((Sint32)(controls->probes[i].input - shown) > 0) break;
+		Profiler_Input(controls->probes[i].time, presented);
+	}
 }
 
 
@@ -214,17 +470,11 @@ static void render_bg(int pos) {
 static void game_loop(void) {
 
 	// scroll background //
-	SDL_Surface *bg_surface = SDL_LoadBMP("Images/space.bmp");
-	bg = SDL_CreateTextureFromSurface(renderer, bg_surface);
-	SDL_FreeSurface(bg_surface);
 	float bg_pos = 0;
 	
 	// game over screen //
-	SDL_Surface *game_over_surface = SDL_LoadBMP("Images/game.bmp");
-	SDL_Texture *game_over_texture = SDL_CreateTextureFromSurface(renderer, game_over_surface);
-	SDL_FreeSurface(game_over_surface);
-	int game_over_w, game_over_h;
-	SDL_QueryTexture(game_over_texture, NULL, NULL, &game_over_w, &game_over_h);
+	const SDL_Rect game_over_src = TileSheet_getTileRect(game_over_card, 0);
+	const int game_over_w = game_over_src.w, game_over_h = game_over_src.h;
 	SDL_Rect game_over_rect = {
 		.x = WIDTH / 2 - game_over_w * GAME_OVER_SCALE / 2,
 		.y = HEIGHT / 2 - game_over_h * GAME_OVER_SCALE / 2,
@@ -235,102 +485,580 @@ static void game_loop(void) {
 		.x = WIDTH - 10 * 8,
 		.y = 0
 	};
+
+	// card and scores stay put while the background scrolls, so they are one layer //
+	struct Game_Over_Panel panel = {game_over_src, game_over_rect, high_score_point, 0};
+	const SDL_Rect panel_bounds = {0, 0, WIDTH, game_over_rect.y + game_over_rect.h};
+	Layer *game_over_layer = Layer_Create(renderer, panel_bounds, false, draw_game_over, &panel);
+	if (!game_over_layer) {
+		fprintf(stderr, "Could not create game over panel: %s\n", SDL_GetError());
+		exit(1);
+	}
+
+	// explosion frames in normalized atlas coordinates //
+	SDL_FRect explosion_frames[PARTICLE_FRAMES];
+	for (int i = 0; i < PARTICLE_FRAMES; ++i) {
+		const SDL_Rect frame = TileSheet_getTileRect(explosion, i);
+		explosion_frames[i] = (SDL_FRect) {
+			.x = (float)frame.x / atlas->width,
+			.y = (float)frame.y / atlas->height,
+			.w = (float)frame.w / atlas->width,
+			.h = (float)frame.h / atlas->height
+		};
+	}
+
+	// HUD text, neither is baked since the high score follows the score while a record is being set //
+	CachedText *score_text = CachedText_create(font, NULL, SDL_FALSE);
+	CachedText *high_score_text = CachedText_create(font, &high_score_point, SDL_FALSE);
+	if (!score_text || !high_score_text) {
+		fprintf(stderr, "Could not create HUD text: %s\n", SDL_GetError());
+		exit(1);
+	}
 	
-	// Initializes game //
+	// Initializes game, the simulation owns it and the recording until the loop ends //
+	sim = Simulation_Create(game, tick_rate, session_tick, recording);
+	if (!sim) {
+		fprintf(stderr, "Could not start simulation: %s\n", SDL_GetError());
+		exit(1);
+	}
+	recording = NULL;
 	init();
-   	srand(time(NULL)); //<--
-	Uint64 game_time = SDL_GetTicks64();
-	Uint64 points_timer = 0, start_time = 0, score = 0;
+	const Uint64 frequency = SDL_GetPerformanceFrequency();
+	Uint64 game_time = SDL_GetPerformanceCounter();
+	Uint32 current_game = 1;			// snapshots of earlier games are ignored
+	Uint32 seen_hits = 0, seen_points = 0;
+	struct Controls controls = {0};
+	Uint32 shown_inputs = 0;			// direction changes applied by the step on screen
+	bool started = false;				// the intro finished and the game is stepping
+	Uint64 score = 0;
 	bool quit = false;
 	bool game_over = false;
 	while (!quit) {
 		Uint64 prev_time = game_time;
-		game_time = SDL_GetTicks64();
-		Uint64 delta_t = game_time - prev_time;
+		game_time = SDL_GetPerformanceCounter();
+		double delta_t = (double)(game_time - prev_time) / frequency;
+		if (delta_t > MAX_FRAME_TIME) delta_t = MAX_FRAME_TIME;
 
-		// Sets player control keys //
+		// Sets player control keys, each change is sent with the time of its event //
+		Uint64 zone = Profiler_Begin();
+		SDL_PumpEvents();
+		const Uint32 ticks = SDL_GetTicks();
+		const Uint64 now = SDL_GetPerformanceCounter();
 		SDL_Event e;
 		while (SDL_PollEvent(&e)) {
 			switch (e.type) {
 				case SDL_QUIT: {
 					quit = true;
 				} break;
-				case SDL_KEYDOWN: {
-					if (!e.key.repeat) switch (e.key.keysym.sym) {
+				case SDL_RENDER_TARGETS_RESET: {
+					Layer_Invalidate(game_over_layer);
+				} break;
+				case SDL_KEYDOWN:
+				case SDL_KEYUP: {
+					if (e.key.repeat) break;
+					const bool down = e.type == SDL_KEYDOWN;
+					if (e.key.keysym.scancode == SDL_SCANCODE_LEFT) controls.left = down;
+					else if (e.key.keysym.scancode == SDL_SCANCODE_RIGHT) controls.right = down;
+					steer(&controls, event_time(e.key.timestamp, ticks, now), started && !game_over);
+					if (down) switch (e.key.keysym.sym) {
 						case SDLK_ESCAPE: {
 							quit = true;
 						} break;
-						case SDLK_LEFT: {
-							--player->direction;
-						} break;
-						case SDLK_RIGHT: {
-							++player->direction;
+						case SDLK_F3: {
+							show_profiler = !show_profiler;
 						} break;
 						case SDLK_r: {
+							// a game abandoned mid play still counts //
+							if (!game_over) submit_score(score);
 							game_over = false;
+							started = false;
+							// the new game starts still, held keys are sent again below //
+							controls.direction = 0;
+							controls.tail = controls.head;
+							++current_game;
 							init();
 						} break;
 					}
 				} break;
-				case SDL_KEYUP: {
-					if (!e.key.repeat) switch (e.key.keysym.sym) {
-						case SDLK_LEFT: {
-							++player->direction;
-						} break;
-						case SDLK_RIGHT: {
-							--player->direction;
-						} break;
-					}
-				} break;
 			}
         }
 
+		// the keyboard state is the final word, so a lost key up or focus change never leaves the ship drifting //
+		const Uint8 *keys = SDL_GetKeyboardState(NULL);
+		controls.left = keys[SDL_SCANCODE_LEFT];
+		controls.right = keys[SDL_SCANCODE_RIGHT];
+		steer(&controls, now, started && !game_over);
+		Profiler_End(PROFILE_EVENTS, zone);
+
+		// newest finished step, events since the last one seen play now //
+		const Snapshot *snapshot = Simulation_Latest(sim);
+		const bool current = snapshot->game == current_game;
+		if (snapshot->points != seen_points) {
+			seen_points = snapshot->points;
+			Sound_Play(points);
+		}
+		if (snapshot->hits != seen_hits) {
+			seen_hits = snapshot->hits;
+			Sound_Play(boom);
+			Particle_System_Burst(
+				particles, snapshot->hit_position + SHIP_WIDTH / 2, SHIP_Y + SHIP_HEIGHT / 2,
+				EXPLOSION_PARTICLES, EXPLOSION_SPEED
+			);
+		}
+
 	// Render Graphics //
         if (game_over) {
-			bg_pos += BG_VELOCITY * (delta_t / 1000.0);
+			bg_pos += BG_VELOCITY * delta_t;
 		  	if (bg_pos >= 320) bg_pos -= 320;
-            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-            SDL_RenderClear(renderer);
             render_bg(bg_pos);
-            SDL_RenderCopy(renderer, game_over_texture, NULL, &game_over_rect);
-            Font_renderFormatted(font, renderer, NULL, "SCORE\n%lld", score);
-            Font_renderFormatted(font, renderer, &high_score_point, "HIGH SCORE\n%010d", high_score);
+            // debris goes under the panel on either path, the panel is drawn after the frame is uploaded //
+            update_particles(delta_t, explosion_frames);
+            present_frame();
+            Layer_Render(game_over_layer, renderer);
+
+            // the ship is gone, nothing on screen shows the input any more //
+            controls.tail = controls.head;
         } 
         else {
-            if (!Mix_Playing(1)) {
-                points_timer += delta_t;
-                if (points_timer >= 10000) {
-                	Mix_PlayChannel(-1, points, 0);
-                	points_timer -= 10000;
-                }
-                physics(delta_t);
-		bg_pos += BG_VELOCITY * (delta_t / 1000.0);
+            if (!started && !Sound_Playing(intro)) started = Simulation_Send(sim, SIM_START, 0, 0);
+            if (started) {
+		bg_pos += BG_VELOCITY * delta_t;
           	if (bg_pos >= 320) bg_pos -= 320;
-            } else {
-                start_time = game_time;
-                points_timer = 0;
             }
-            score = (game_time - start_time) / 10;
-            if (score > high_score) high_score = score;
-            game_over = collision();
-            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-            SDL_RenderClear(renderer);
+
+            // the snapshot is up to a step old, blend towards it by the time since it was taken //
+            double alpha = (double)(SDL_GetPerformanceCounter() - snapshot->time) * tick_rate / frequency;
+            if (alpha > 1) alpha = 1;
+            score = current ? snapshot->score : 0;
+            if (score > (Uint64)high_score) high_score = score;
+            game_over = current && snapshot->over;
+            if (game_over) {
+                panel.score = score;
+                Layer_Invalidate(game_over_layer);
+                submit_score(score);
+            }
             render_bg(bg_pos);
-            Font_renderFormatted(font, renderer, NULL, "SCORE\n%lld", score);
-            Font_renderFormatted(font, renderer, &high_score_point, "HIGH SCORE\n%010d", high_score);
-            Space_Ship_Render(player, renderer);
-            draw_rock();
+            render_hud(score_text, high_score_text, score);
+            shown_inputs = snapshot->inputs;
+            render_ship(lerp(snapshot->prev_ship_position, snapshot->ship_position, alpha));
+            draw_rock(snapshot, alpha);
+            update_particles(delta_t, explosion_frames);
+            present_frame();
 		}
+        if (show_profiler) {
+            Profiler_Render(font, renderer);
+            render_audio_stats();
+        }
+        zone = Profiler_Begin();
         SDL_RenderPresent(renderer);
+        Profiler_End(PROFILE_PRESENT, zone);
+        probe_presented(&controls, shown_inputs, SDL_GetPerformanceCounter());
+        zone = Profiler_Begin();
+        Frame_Pacer_Wait(&pacer);
+        Profiler_End(PROFILE_PACING, zone);
+        Profiler_Frame();
 	}
-	SDL_DestroyTexture(game_over_texture);
-	SDL_DestroyTexture(bg);
+
+	// the game and recording come back from the simulation //
+	Simulation_Stop(sim);
+	session_tick = sim->tick;
+	recording = sim->recording;
+	Simulation_Destroy(sim);
+	sim = NULL;
+
+	// a game quit part way still counts //
+	if (!game_over) submit_score(score);
+	CachedText_destroy(score_text);
+	CachedText_destroy(high_score_text);
+	Layer_Destroy(game_over_layer);
+}
+
+
+// Gives a windowless game the same pixel collision as the window, no texture is made //
+static bool load_ship_mask(void) {
+
+	TileSheet *tiles = TileSheet_create("Images/ship.bmp", NULL, SHIP_WIDTH, SHIP_HEIGHT, TILESHEET_CREATEMASK);
+	if (!tiles) {
+		fprintf(stderr, "Could not load ship mask: %s\n", SDL_GetError());
+		return false;
+	}
+	Game_SetShipMask(game, TileSheet_getTileMask(tiles, 0));
+	TileSheet_destroy(tiles);
+	return true;
+}
+
+
+// Headless soak run, steps the game as fast as possible //
+static int headless(Uint64 ticks) {
+
+	const float delta_t = 1.0f / tick_rate;
+	Uint64 games = 0, hits = 0, total_score = 0;
+	game = Game_Create(rock_count);
+	if (!game) {
+		fprintf(stderr, "Could not create game: %s\n", SDL_GetError());
+		return 1;
+	}
+	if (!load_ship_mask()) {
+		Game_Destroy(game);
+		return 1;
+	}
+	game->invulnerable = stress;
+	Game_Init(game, Game_Random(&session_rng));
+	Uint64 start = SDL_GetPerformanceCounter();
+	for (Uint64 tick = 0; tick < ticks; ++tick) {
+		Profiler_Frame();
+		if (Game_Step(game, delta_t) & GAME_EVENT_HIT) {
+			++hits;
+			if (game->over) {
+				++games;
+				total_score += Game_Score(game);
+				Game_Init(game, Game_Random(&session_rng));
+			}
+		}
+	}
+	double seconds = (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+	printf("seed: %llu\n", (unsigned long long)session_seed);
+	printf("rocks: %lu\n", (unsigned long)rock_count);
+	printf("ticks: %llu\n", (unsigned long long)ticks);
+	printf("seconds: %.3f\n", seconds);
+	printf("ticks/sec: %.0f\n", ticks / seconds);
+	printf("games: %llu\n", (unsigned long long)games);
+	printf("hits: %llu\n", (unsigned long long)hits);
+	printf("average score: %llu\n", (unsigned long long)(games ? total_score / games : 0));
+	Game_Destroy(game);
+	return 0;
+}
+
+
+// Bot games played in parallel, each worker reuses its own game //
+struct Batch {
+	Game *games[POOL_MAX_THREADS];
+	const Bot_Policy *policy;
+	float delta_t;
+	Uint64 max_ticks;
+	Uint64 *seeds;				// drawn up front so results never depend on which worker plays a game
+	Uint64 *scores;
+	double *survived;			// seconds each game lasted
+	bool *capped;				// still alive at BATCH_MAX_SECONDS
+};
+
+
+// Plays one batch game //
+static void play_bot_game(void *data, int worker, Uint32 index) {
+
+	struct Batch *batch = data;
+	Game *bot_game = batch->games[worker];
+	Bot_Play(bot_game, batch->policy, batch->seeds[index], batch->delta_t, batch->max_ticks);
+	batch->scores[index] = Game_Score(bot_game);
+	batch->survived[index] = bot_game->time;
+	batch->capped[index] = !bot_game->over;
+}
+
+
+static int compare_seconds(const void *a, const void *b) {
+	const double x = *(const double *)a, y = *(const double *)b;
+	return (x > y) - (x < y);
+}
+
+
+// Prints the score histogram and survival percentiles //
+static void report_batch(const struct Batch *batch, Uint32 count) {
+
+	Uint64 max_score = 0, total_score = 0, capped = 0;
+	for (Uint32 i = 0; i < count; ++i) {
+		if (batch->scores[i] > max_score) max_score = batch->scores[i];
+		total_score += batch->scores[i];
+		capped += batch->capped[i];
+	}
+	printf("average score: %llu\n", (unsigned long long)(total_score / count));
+	printf("survived %d seconds: %llu\n", BATCH_MAX_SECONDS, (unsigned long long)capped);
+
+	// survival percentiles, nearest rank //
+	qsort(batch->survived, count, sizeof(double), compare_seconds);
+	const int percentiles[] = {10, 25, 50, 75, 90, 99};
+	printf("survival seconds:");
+	for (size_t i = 0; i < SDL_arraysize(percentiles); ++i) {
+		const Uint32 rank = ((Uint64)percentiles[i] * count + 99) / 100;
+		printf(" p%d %.2f", percentiles[i], batch->survived[rank ? rank - 1 : 0]);
+	}
+	printf("\n");
+
+	// buckets are a whole number of seconds wide //
+	Uint64 width = (max_score / BATCH_BUCKETS + 100) / 100 * 100;
+	Uint64 buckets[BATCH_BUCKETS] = {0}, tallest = 0;
+	for (Uint32 i = 0; i < count; ++i) {
+		Uint64 *bucket = &buckets[SDL_min(batch->scores[i] / width, BATCH_BUCKETS - 1)];
+		if (++*bucket > tallest) tallest = *bucket;
+	}
+	printf("score histogram:\n");
+	for (int i = 0; i < BATCH_BUCKETS; ++i) {
+		char bar[BATCH_BAR + 1];
+		const int length = buckets[i] * BATCH_BAR / tallest;
+		SDL_memset(bar, '#', length);
+		bar[length] = '\0';
+		printf("%8llu - %-8llu %-*s %llu\n", (unsigned long long)(i * width), (unsigned long long)((i + 1) * width),
+			BATCH_BAR, bar, (unsigned long long)buckets[i]);
+	}
+}
+
+
+// Frees what batch_run made //
+static void free_batch(struct Batch *batch, Work_Pool *pool, TileSheet *tiles) {
+
+	for (int i = 0; i < POOL_MAX_THREADS; ++i) Game_Destroy(batch->games[i]);
+	Work_Pool_Destroy(pool);
+	if (tiles) TileSheet_destroy(tiles);
+	SDL_free(batch->capped);
+	SDL_free(batch->survived);
+	SDL_free(batch->scores);
+	SDL_free(batch->seeds);
+}
+
+
+// Plays many bot games across every core and reports how they went //
+static int batch_run(Uint32 count, int threads, const Bot_Policy *policy) {
+
+	struct Batch batch = {
+		.policy = policy,
+		.delta_t = 1.0f / tick_rate,
+		.max_ticks = (Uint64)BATCH_MAX_SECONDS * tick_rate,
+		.seeds = SDL_malloc(count * sizeof(Uint64)),
+		.scores = SDL_malloc(count * sizeof(Uint64)),
+		.survived = SDL_malloc(count * sizeof(double)),
+		.capped = SDL_malloc(count * sizeof(bool))
+	};
+	if (!batch.seeds || !batch.scores || !batch.survived || !batch.capped) {
+		fprintf(stderr, "Could not allocate batch results.\n");
+		free_batch(&batch, NULL, NULL);
+		return 1;
+	}
+	TileSheet *tiles = TileSheet_create("Images/ship.bmp", NULL, SHIP_WIDTH, SHIP_HEIGHT, TILESHEET_CREATEMASK);
+	if (!tiles) {
+		fprintf(stderr, "Could not load ship mask: %s\n", SDL_GetError());
+		free_batch(&batch, NULL, NULL);
+		return 1;
+	}
+	Work_Pool *pool = Work_Pool_Create(threads);
+	if (!pool) {
+		fprintf(stderr, "Could not create work pool: %s\n", SDL_GetError());
+		free_batch(&batch, NULL, tiles);
+		return 1;
+	}
+	for (int i = 0; i < pool->thread_count; ++i) {
+		batch.games[i] = Game_Create(rock_count);
+		if (!batch.games[i]) {
+			fprintf(stderr, "Could not create game: %s\n", SDL_GetError());
+			free_batch(&batch, pool, tiles);
+			return 1;
+		}
+		Game_SetShipMask(batch.games[i], TileSheet_getTileMask(tiles, 0));
+		batch.games[i]->invulnerable = stress;
+	}
+	for (Uint32 i = 0; i < count; ++i) batch.seeds[i] = Game_Random(&session_rng);
+
+	Uint64 start = SDL_GetPerformanceCounter();
+	if (!Work_Pool_For(pool, count, 1, play_bot_game, &batch)) {
+		fprintf(stderr, "Could not run batch: %s\n", SDL_GetError());
+		free_batch(&batch, pool, tiles);
+		return 1;
+	}
+	double seconds = (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+
+	double played = 0;
+	for (Uint32 i = 0; i < count; ++i) played += batch.survived[i];
+	printf("seed: %llu\n", (unsigned long long)session_seed);
+	printf("policy: %s\n", policy->name);
+	printf("rocks: %lu\n", (unsigned long)rock_count);
+	printf("games: %u\n", count);
+	printf("threads: %d\n", pool->thread_count);
+	printf("steals: %d\n", SDL_AtomicGet(&pool->steals));
+	printf("seconds: %.3f\n", seconds);
+	printf("games/sec: %.1f\n", count / seconds);
+	printf("ticks/sec: %.0f\n", played * tick_rate / seconds);
+	report_batch(&batch, count);
+	free_batch(&batch, pool, tiles);
+	return 0;
+}
+
+
+// Re-runs a recorded session as fast as possible, reporting where each game ended //
+static int playback(const char *path) {
+
+	Replay *replay = Replay_Load(path);
+	if (!replay) {
+		fprintf(stderr, "Could not load replay: %s\n", SDL_GetError());
+		return 1;
+	}
+	const Replay_Header *header = &replay->header;
+	const float delta_t = 1.0f / header->tick_rate;
+	game = Game_Create(header->rock_count);
+	if (!game) {
+		fprintf(stderr, "Could not create game: %s\n", SDL_GetError());
+		Replay_Destroy(replay);
+		return 1;
+	}
+	if (!load_ship_mask()) {
+		Game_Destroy(game);
+		Replay_Destroy(replay);
+		return 1;
+	}
+	game->invulnerable = header->flags & REPLAY_INVULNERABLE;
+	session_rng = header->seed;
+	Game_Init(game, Game_Random(&session_rng));
+
+	int result = 0;
+	Uint32 next = 0, games = 0;
+	Uint64 start = SDL_GetPerformanceCounter();
+	for (Uint32 tick = 0;; ++tick) {
+		Profiler_Frame();
+		for (; next < header->event_count && replay->events[next].tick == tick; ++next) {
+			const Replay_Event *event = &replay->events[next];
+			if (event->type == REPLAY_RESET) Game_Init(game, Game_Random(&session_rng));
+			else game->ship_direction = event->direction;
+		}
+		// the header's length is the end, whatever is left in the events //
+		if (tick >= header->ticks) break;
+		if (game->over) {
+			// a recorded game only stops stepping until the next reset //
+			fprintf(stderr, "Replay diverged: game over at tick %u with input still to play.\n", tick);
+			result = 1;
+			break;
+		}
+		if ((Game_Step(game, delta_t) & GAME_EVENT_HIT) && game->over) {
+			printf("game %u: score %llu at tick %u\n", ++games, (unsigned long long)Game_Score(game), tick + 1);
+		}
+	}
+	double seconds = (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+	printf("seed: %llu\n", (unsigned long long)header->seed);
+	printf("rocks: %lu\n", (unsigned long)header->rock_count);
+	printf("ticks: %u\n", header->ticks);
+	printf("events: %u\n", header->event_count);
+	printf("seconds: %.3f\n", seconds);
+	printf("ticks/sec: %.0f\n", header->ticks / seconds);
+	printf("final score: %llu\n", (unsigned long long)Game_Score(game));
+	Game_Destroy(game);
+	Replay_Destroy(replay);
+	return result;
+}
+
+
+// Writes the profiler trace if one was asked for //
+static void write_trace(void) {
+	if (trace_path && !Profiler_WriteTrace(trace_path)) {
+		fprintf(stderr, "Could not write trace: %s\n", SDL_GetError());
+	}
+}
+
+
+// Command line usage //
+static void usage(const char *name) {
+	fprintf(stderr, "usage: %s [--tick-rate HZ] [--rocks N | --stress] [--headless [--ticks N]] [--seed N]\n"
+		"       [--fps N] [--no-vsync] [--softfb] [--audio-buffer FRAMES] [--record FILE | --replay FILE] [--trace FILE]\n"
+		"       [--batch GAMES [--threads N] [--policy NAME]]\n", name);
+	fprintf(stderr, "policies:\n");
+	for (int i = 0; i < bot_policy_count; ++i) fprintf(stderr, "  %-8s %s\n", bot_policies[i].name, bot_policies[i].description);
 }
 
 
 // Main //
 int main(int argc, char *argv[]) {
 
+	// Command line options //
+	bool headless_mode = false;
+	const char *replay_path = NULL;
+	Uint32 batch_games = 0;
+	int threads = SDL_GetCPUCount();
+	const Bot_Policy *policy = &bot_policies[0];
+	session_seed = (Uint64)time(NULL) ^ SDL_GetPerformanceCounter();
+	Uint64 ticks = HEADLESS_TICKS;
+	for (int i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "--headless") == 0) {
+			headless_mode = true;
+		} else if (strcmp(argv[i], "--batch") == 0 && i + 1 < argc) {
+			const unsigned long games = strtoul(argv[++i], NULL, 10);
+			batch_games = games;
+			if (games == 0 || games > POOL_MAX_COUNT) {
+				usage(argv[0]);
+				return 1;
+			}
+		} else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+			threads = atoi(argv[++i]);
+			if (threads < 1 || threads > POOL_MAX_THREADS) {
+				usage(argv[0]);
+				return 1;
+			}
+		} else if (strcmp(argv[i], "--policy") == 0 && i + 1 < argc) {
+			policy = Bot_Find(argv[++i]);
+			if (!policy) {
+				usage(argv[0]);
+				return 1;
+			}
+		} else if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+			ticks = strtoull(argv[++i], NULL, 10);
+		} else if (strcmp(argv[i], "--tick-rate") == 0 && i + 1 < argc) {
+			tick_rate = atoi(argv[++i]);
+			if (tick_rate <= 0) {
+				usage(argv[0]);
+				return 1;
+			}
+		} else if (strcmp(argv[i], "--rocks") == 0 && i + 1 < argc) {
+			rock_count = strtoul(argv[++i], NULL, 10);
+		} else if (strcmp(argv[i], "--stress") == 0) {
+			rock_count = STRESS_ROCKS;
+			stress = true;
+		} else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+			trace_path = argv[++i];
+		} else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+			session_seed = strtoull(argv[++i], NULL, 10);
+		} else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+			record_path = argv[++i];
+		} else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+			replay_path = argv[++i];
+		} else if (strcmp(argv[i], "--fps") == 0 && i + 1 < argc) {
+			fps_cap = atoi(argv[++i]);
+			if (fps_cap < 0) {
+				usage(argv[0]);
+				return 1;
+			}
+		} else if (strcmp(argv[i], "--softfb") == 0) {
+			softfb = true;
+		} else if (strcmp(argv[i], "--no-vsync") == 0) {
+			vsync = false;
+		} else if (strcmp(argv[i], "--audio-buffer") == 0 && i + 1 < argc) {
+			audio_buffer = atoi(argv[++i]);
+			if (audio_buffer <= 0 || audio_buffer > 8192) {
+				usage(argv[0]);
+				return 1;
+			}
+		} else {
+			usage(argv[0]);
+			return 1;
+		}
+	}
+	session_rng = session_seed;
+
+	// Open packed assets, loose files are used without them //
+	Assets_Open(ASSETS_FILE);
+	if (headless_mode || replay_path || batch_games) {
+		// headless runs only pay for profiling when a trace is asked for //
+		Profiler_Enable(trace_path != NULL);
+		const int result =
+			replay_path ? playback(replay_path) :
+			batch_games ? batch_run(batch_games, threads, policy) :
+			headless(ticks);
+		write_trace();
+		Assets_Close();
+		return result;
+	}
+	Profiler_Enable(true);
+	if (record_path) {
+		recording = Replay_Create(session_seed, tick_rate, rock_count, stress ? REPLAY_INVULNERABLE : 0);
+		if (!recording) {
+			fprintf(stderr, "Could not start recording: %s\n", SDL_GetError());
+			return 1;
+		}
+	}
+
 	// Creates game window //
 	if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) < 0) {
 		fprintf(stderr, "SDL_Init: %s\n", SDL_GetError());
@@ -340,7 +1068,7 @@ int main(int argc, char *argv[]) {
 	    "Space Dodge",										// title
 	    SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,	// window position
 	    WIDTH * SCALE, HEIGHT * SCALE,						// window size
-	    SDL_RENDERER_PRESENTVSYNC							// window flags
+	    0													// window flags
     );
 	if (!window) {
 		fprintf(stderr, "SDL_CreateWindow: %s\n", SDL_GetError());
@@ -348,58 +1076,109 @@ int main(int argc, char *argv[]) {
 	}
 	
 	// Create Renderer //
-	renderer = SDL_CreateRenderer(window, -1, 0);
+	renderer = SDL_CreateRenderer(window, -1, vsync ? SDL_RENDERER_PRESENTVSYNC : 0);
 	if (!renderer) {
 		fprintf(stderr, "SDL_CreateRenderer: %s\n", SDL_GetError());
 		return 1;
 	}
+
+	// Without vsync frames are capped to the display rate so they do not spin //
+	if (fps_cap < 0) {
+		SDL_RendererInfo info;
+		SDL_DisplayMode mode;
+		if (SDL_GetRendererInfo(renderer, &info) == 0 && (info.flags & SDL_RENDERER_PRESENTVSYNC)) fps_cap = 0;
+		else if (SDL_GetWindowDisplayMode(window, &mode) == 0 && mode.refresh_rate > 0) fps_cap = mode.refresh_rate;
+		else fps_cap = FALLBACK_FPS;
+	}
+	Frame_Pacer_Init(&pacer, fps_cap);
+
+	// every particle costs a rasterized quad on a software renderer, so fewer are drawn there //
+	SDL_RendererInfo info;
+	if (SDL_GetRendererInfo(renderer, &info) == 0 && (info.flags & SDL_RENDERER_SOFTWARE)) {
+		particle_budget = SOFTWARE_PARTICLES;
+		softfb = true;
+	}
     SDL_RenderSetLogicalSize(renderer, WIDTH, HEIGHT);
 
 	// Create Mixer //
-	if (Mix_OpenAudio(48000, AUDIO_S16SYS, 2, 2048) < 0) {
-	    fprintf(stderr, "Mix_OpenAudio: %s\n", SDL_GetError());
+	if (!Sound_Open(AUDIO_FREQUENCY, audio_buffer)) {
+	    fprintf(stderr, "Could not open audio: %s\n", SDL_GetError());
 	    return 1;
 	}
-	intro = Mix_LoadWAV("Music/Sounds/intro.wav");
-	if (!intro) {
-	    fprintf(stderr, "Could not load left sound: %s\n", SDL_GetError());
+	
+	// Create Atlas //
+	atlas = Atlas_Create(renderer, ATLAS_WIDTH, ATLAS_HEIGHT);
+	if (!atlas) {
+	    fprintf(stderr, "Could not create atlas: %s\n", SDL_GetError());
 	    return 1;
 	}
-	points = Mix_LoadWAV("Music/Sounds/points.wav");
-	if (!intro) {
-	    fprintf(stderr, "Could not load left sound: %s\n", SDL_GetError());
+	if (softfb && (!Atlas_KeepPixels(atlas) || !(frame = Soft_Frame_Create(renderer, atlas, WIDTH, HEIGHT)))) {
+	    fprintf(stderr, "Could not create software frame: %s\n", SDL_GetError());
 	    return 1;
 	}
-	boom = Mix_LoadWAV("Music/Sounds/boom.wav");
-	if (!intro) {
-	    fprintf(stderr, "Could not load left sound: %s\n", SDL_GetError());
+	
+	// Start loading, everything but the title screen finishes behind it //
+	loader = Loader_Create(LOADER_THREADS);
+	if (!loader) {
+	    fprintf(stderr, "Could not create loader: %s\n", SDL_GetError());
 	    return 1;
 	}
+	Load_Job *jobs[] = {&title_job, &font_job, &ship_job, &bg_job, &game_over_job, &explosion_job, &intro_job, &points_job, &boom_job};
+	for (size_t i = 0; i < SDL_arraysize(jobs); ++i) Loader_Queue(loader, jobs[i]);
 	
-	// Create Font //
-	font = Font_create("Images/font.bmp", renderer, 1);
-	if (!font) {
-	    fprintf(stderr, "Could not load font: %s\n", SDL_GetError());
+	// Create Game //
+	game = Game_Create(rock_count);
+	if (!game) {
+		fprintf(stderr, "Could not create game: %s\n", SDL_GetError());
 	    return 1;
 	}
-	
-	// Create Player //
-	player = Space_Ship_Create(renderer);
-	if (!player) {
-		fprintf(stderr, "Could not create ship: %s\n", SDL_GetError());
+	game->invulnerable = stress;
+	rock_batch = Quad_Batch_Create(rock_count);
+	if (!rock_batch) {
+		fprintf(stderr, "Could not create rock batch: %s\n", SDL_GetError());
 	    return 1;
 	}
-	
+	particles = Particle_System_Create(PARTICLE_CAPACITY);
+	particle_batch = Quad_Batch_Create(PARTICLE_CAPACITY);
+	if (!particles || !particle_batch) {
+		fprintf(stderr, "Could not create particles: %s\n", SDL_GetError());
+	    return 1;
+	}
+
 	// Game Program //
 	title_screen();
-	high_score = get_hscore();
+	Loader_Destroy(loader);
+	if (!Leaderboard_Load(&leaderboard, SCORES_FILE)) fprintf(stderr, "Starting a new leaderboard: %s\n", SDL_GetError());
+	high_score = Leaderboard_Best(&leaderboard);
+	score_writer = Score_Writer_Create(SCORES_FILE);
+	if (!score_writer) fprintf(stderr, "Saving scores on the main thread: %s\n", SDL_GetError());
 	game_loop();
-	set_hscore(high_score);
+	Score_Writer_Destroy(score_writer);
+	write_trace();
+	if (recording) {
+		recording->header.ticks = session_tick;
+		if (!Replay_Save(recording, record_path)) fprintf(stderr, "Could not save replay: %s\n", SDL_GetError());
+		Replay_Destroy(recording);
+	}
 	
 	// End of Game Program //
+	Quad_Batch_Destroy(rock_batch);
+	Quad_Batch_Destroy(particle_batch);
+	Particle_System_Destroy(particles);
+	Game_Destroy(game);
 	Space_Ship_Destroy(player);
 	Font_destroy(font);
-	Mix_FreeChunk(intro);
+	TileSheet_destroy(bg);
+	TileSheet_destroy(title_card);
+	TileSheet_destroy(game_over_card);
+	TileSheet_destroy(explosion);
+	Soft_Frame_Destroy(frame);
+	Atlas_Destroy(atlas);
+	Sound_Close();
+	Sound_Destroy(intro);
+	Sound_Destroy(points);
+	Sound_Destroy(boom);
+	Assets_Close();
 	SDL_DestroyRenderer(renderer);
 	SDL_DestroyWindow(window);
 	Mix_Quit();
@@ -0,0 +1,53 @@
+///////////////////////////|
+//|File: pacer.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Frame rate limiter. Most of the wait is slept so the CPU is free,
+ * and only the last couple of milliseconds are spun on the performance
+ * counter so frames still end on time.
+ */
+
+//----------------------------------------------------------------
+
+// SDL2 //
+#include <SDL2/SDL.h>
+
+// Header Files //
+#include "pacer.h"
+
+
+// Start pacing at fps frames per second, 0 leaves frames uncapped //
+void Frame_Pacer_Init(Frame_Pacer *pacer, int fps) {
+
+	const Uint64 frequency = SDL_GetPerformanceFrequency();
+	*pacer = (Frame_Pacer) {
+		.period = fps > 0 ? frequency / fps : 0,
+		.deadline = SDL_GetPerformanceCounter(),
+		.margin = frequency * PACER_SPIN_MS / 1000
+	};
+}
+
+
+// Waits for the end of the current frame //
+void Frame_Pacer_Wait(Frame_Pacer *pacer) {
+
+	if (!pacer->period) return;
+	const Uint64 now = SDL_GetPerformanceCounter();
+	pacer->deadline += pacer->period;
+	if (now >= pacer->deadline) {
+		// running late, start over from now instead of rushing frames to catch up //
+		pacer->deadline = now;
+		return;
+	}
+	const Uint64 remaining = pacer->deadline - now;
+	if (remaining > pacer->margin) {
+		SDL_Delay((Uint32)((remaining - pacer->margin) * 1000 / SDL_GetPerformanceFrequency()));
+	}
+	while (SDL_GetPerformanceCounter() < pacer->deadline);
+}
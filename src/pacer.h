@@ -0,0 +1,27 @@
+///////////////////////////|
+//|File: pacer.h
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+//----------------------------------------------------------------
+
+#ifndef PACER_H
+#define PACER_H
+
+#define PACER_SPIN_MS 2		// last part of a frame wait is spun, SDL_Delay can oversleep this much
+
+// Keeps frames at most one period apart //
+typedef struct {
+	Uint64 period;		// counter ticks per frame, 0 when uncapped
+	Uint64 deadline;	// counter value the current frame ends at
+	Uint64 margin;		// ticks before the deadline where sleeping stops and spinning starts
+} Frame_Pacer;
+
+void Frame_Pacer_Init(Frame_Pacer *pacer, int fps);
+
+void Frame_Pacer_Wait(Frame_Pacer *pacer);
+
+#endif
@@ -0,0 +1,153 @@
+///////////////////////////|
+//|File: particles.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Explosion debris. Particles live in one preallocated structure-of-arrays
+ * pool, so bursts never allocate. Updating is a straight pass over the arrays
+ * followed by a compaction that drops the dead, and drawing fills one quad
+ * batch that is submitted with a single geometry call.
+ */
+
+//----------------------------------------------------------------
+
+// SDL2 //
+#include <SDL2/SDL.h>
+
+// Header Files //
+#include "quad.h"
+#include "particles.h"
+#include "shared.h"
+
+#define PARTICLE_ARRAYS 7
+#define PARTICLE_FADE 0.3f		// last part of a particle's life it spends fading out
+
+
+// Next random float in [0, 1) //
+static float random_unit(Particle_System *particles) {
+	Uint32 x = particles->rng;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	particles->rng = x;
+	return (x >> 8) * (1.0f / 16777216.0f);
+}
+
+
+// Create particle pool, everything is allocated here //
+Particle_System *Particle_System_Create(Uint32 capacity) {
+
+	Particle_System *particles = SDL_malloc(sizeof(Particle_System));
+	if (!particles) {
+		SDL_SetError("Failed to allocate memory for particles.");
+		return NULL;
+	}
+	float *block = SDL_SIMDAlloc((capacity ? capacity : 1) * PARTICLE_ARRAYS * sizeof(float));
+	if (!block) {
+		SDL_free(particles);
+		SDL_SetError("Failed to allocate memory for %u particles.", capacity);
+		return NULL;
+	}
+	*particles = (Particle_System) {
+		.x = block,
+		.y = block + capacity,
+		.vx = block + capacity * 2,
+		.vy = block + capacity * 3,
+		.age = block + capacity * 4,
+		.life = block + capacity * 5,
+		.size = block + capacity * 6,
+		.capacity = capacity,
+		.rng = 0x2545F491
+	};
+	return particles;
+}
+
+
+// Destroy particle pool //
+void Particle_System_Destroy(Particle_System *particles) {
+	if (!particles) return;
+	SDL_SIMDFree(particles->x);
+	SDL_free(particles);
+}
+
+
+// Kills every particle //
+void Particle_System_Clear(Particle_System *particles) {
+	particles->count = 0;
+}
+
+
+// Throws count particles out from a point, returns how many fit in the pool //
+Uint32 Particle_System_Burst(Particle_System *particles, float x, float y, Uint32 count, float speed) {
+
+	if (count > particles->capacity - particles->count) count = particles->capacity - particles->count;
+	for (Uint32 n = 0; n < count; ++n) {
+		const Uint32 i = particles->count++;
+		const float angle = random_unit(particles) * 2 * M_PI;
+		const float velocity = speed * (0.3f + 0.7f * random_unit(particles));
+		const float size = 2 + 6 * random_unit(particles);
+		particles->x[i] = x - size / 2;
+		particles->y[i] = y - size / 2;
+		particles->vx[i] = SDL_cosf(angle) * velocity;
+		particles->vy[i] = SDL_sinf(angle) * velocity - speed / 2;	// debris is thrown upward
+		particles->age[i] = 0;
+		particles->life[i] = 0.4f + 0.8f * random_unit(particles);
+		particles->size[i] = size;
+	}
+	return count;
+}
+
+
+// Moves every particle and drops the ones that died or fell off screen //
+void Particle_System_Update(Particle_System *particles, float delta_t) {
+
+	const Uint32 count = particles->count;
+	float *restrict x = particles->x, *restrict y = particles->y;
+	float *restrict vx = particles->vx, *restrict vy = particles->vy;
+	float *restrict age = particles->age;
+	const float dv = PARTICLE_GRAVITY * delta_t;
+	for (Uint32 i = 0; i < count; ++i) {
+		x[i] += vx[i] * delta_t;
+		y[i] += vy[i] * delta_t;
+		vy[i] += dv;
+		age[i] += delta_t;
+	}
+
+	// survivors keep their order, so the pool stays packed without a free list //
+	Uint32 live = 0;
+	for (Uint32 i = 0; i < count; ++i) {
+		if (age[i] >= particles->life[i] || y[i] >= HEIGHT) continue;
+		if (live != i) {
+			x[live] = x[i];
+			y[live] = y[i];
+			vx[live] = vx[i];
+			vy[live] = vy[i];
+			age[live] = age[i];
+			particles->life[live] = particles->life[i];
+			particles->size[live] = particles->size[i];
+		}
+		++live;
+	}
+	particles->count = live;
+}
+
+
+// Queues the particles into a batch, at most budget of them spread evenly over the pool, 0 for all //
+void Particle_System_Draw(const Particle_System *particles, Quad_Batch *batch, const SDL_FRect frames[PARTICLE_FRAMES], Uint32 budget) {
+
+	const Uint32 step = budget && particles->count > budget ? (particles->count + budget - 1) / budget : 1;
+	for (Uint32 i = 0; i < particles->count; i += step) {
+		const float t = particles->age[i] / particles->life[i];
+		int frame = t * PARTICLE_FRAMES;
+		if (frame >= PARTICLE_FRAMES) frame = PARTICLE_FRAMES - 1;
+		const float remaining = 1 - t;
+		const SDL_Color color = {255, 255, 255, remaining < PARTICLE_FADE ? remaining / PARTICLE_FADE * 255 : 255};
+		const SDL_FRect dst = {particles->x[i], particles->y[i], particles->size[i], particles->size[i]};
+		if (!Quad_Batch_AddTextured(batch, &dst, &frames[frame], color)) break;
+	}
+}
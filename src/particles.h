@@ -0,0 +1,44 @@
+///////////////////////////|
+//|File: particles.h
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+//----------------------------------------------------------------
+
+#ifndef PARTICLES_H
+#define PARTICLES_H
+
+#include "quad.h"
+
+#define PARTICLE_CAPACITY 32768		// particles alive at once, bursts are cut short past it
+#define PARTICLE_FRAMES 5			// animation frames, a particle plays them once over its life
+#define PARTICLE_GRAVITY 120.0f		// pixels per second squared
+
+// Particle pool, one array per member, live particles are packed at the front //
+typedef struct {
+	float *x, *y;		// top-left corner in pixels
+	float *vx, *vy;		// velocity in pixels per second
+	float *age;			// seconds since the particle spawned
+	float *life;		// seconds the particle lives
+	float *size;		// width and height in pixels
+	Uint32 count;		// live particles
+	Uint32 capacity;
+	Uint32 rng;			// xorshift state, effects never touch the game's random sequence
+} Particle_System;
+
+Particle_System *Particle_System_Create(Uint32 capacity);
+
+void Particle_System_Destroy(Particle_System *particles);
+
+void Particle_System_Clear(Particle_System *particles);
+
+Uint32 Particle_System_Burst(Particle_System *particles, float x, float y, Uint32 count, float speed);
+
+void Particle_System_Update(Particle_System *particles, float delta_t);
+
+void Particle_System_Draw(const Particle_System *particles, Quad_Batch *batch, const SDL_FRect frames[PARTICLE_FRAMES], Uint32 budget);
+
+#endif
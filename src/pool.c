@@ -0,0 +1,198 @@
+///////////////////////////|
+//|File: pool.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Runs parallel loops on a fixed set of worker threads. Each worker keeps
+ * its own deque of index ranges and halves whatever range it takes, leaving
+ * the far half where an idle worker can steal it. Workers only touch each
+ * other's deques when they run dry, so uneven work evens out on its own.
+ */
+
+//----------------------------------------------------------------
+
+// SDL2 //
+#include <SDL2/SDL.h>
+
+// Header Files //
+#include "pool.h"
+
+
+// Adds a range to the bottom of a deque, false when it is full //
+static bool push(Work_Deque *deque, Work_Range range) {
+
+	SDL_AtomicLock(&deque->lock);
+	const bool room = deque->bottom - deque->top < POOL_DEQUE;
+	if (room) deque->ranges[deque->bottom++ % POOL_DEQUE] = range;
+	SDL_AtomicUnlock(&deque->lock);
+	return room;
+}
+
+
+// Takes the newest range from the owner's end //
+static bool pop(Work_Deque *deque, Work_Range *range) {
+
+	SDL_AtomicLock(&deque->lock);
+	const bool found = deque->bottom != deque->top;
+	if (found) *range = deque->ranges[--deque->bottom % POOL_DEQUE];
+	SDL_AtomicUnlock(&deque->lock);
+	return found;
+}
+
+
+// Takes the oldest, and so largest, range from the far end //
+static bool steal(Work_Deque *deque, Work_Range *range) {
+
+	SDL_AtomicLock(&deque->lock);
+	const bool found = deque->bottom != deque->top;
+	if (found) *range = deque->ranges[deque->top++ % POOL_DEQUE];
+	SDL_AtomicUnlock(&deque->lock);
+	return found;
+}
+
+
+// Finds the next range for a worker, its own first //
+static bool next_range(Work_Pool *pool, int index, Work_Range *range) {
+
+	if (pop(&pool->deques[index], range)) return true;
+	for (int i = 1; i < pool->thread_count; ++i) {
+		if (steal(&pool->deques[(index + i) % pool->thread_count], range)) {
+			SDL_AtomicAdd(&pool->steals, 1);
+			return true;
+		}
+	}
+	return false;
+}
+
+
+// Splits a range down to the grain and runs what is left //
+static void run(Work_Pool *pool, int index, Work_Range range) {
+
+	while (range.last - range.first > pool->grain) {
+		const Uint32 mid = range.first + (range.last - range.first) / 2;
+		if (!push(&pool->deques[index], (Work_Range) {mid, range.last})) break;
+		range.last = mid;
+	}
+	for (Uint32 i = range.first; i < range.last; ++i) pool->fn(pool->data, index, i);
+
+	const int count = range.last - range.first;
+	if (SDL_AtomicAdd(&pool->remaining, -count) == count) {
+		SDL_LockMutex(pool->lock);
+		SDL_CondSignal(pool->done);
+		SDL_UnlockMutex(pool->lock);
+	}
+}
+
+
+// Worker thread, works each loop until every index is done //
+static int worker(void *data) {
+
+	Work_Worker *self = data;
+	Work_Pool *pool = self->pool;
+	Uint32 seen = 0;
+	SDL_LockMutex(pool->lock);
+	for (;;) {
+		while (pool->generation == seen && !pool->quit) SDL_CondWait(pool->work, pool->lock);
+		if (pool->quit) break;
+		seen = pool->generation;
+		SDL_UnlockMutex(pool->lock);
+
+		Work_Range range;
+		while (SDL_AtomicGet(&pool->remaining) > 0) {
+			if (next_range(pool, self->index, &range)) run(pool, self->index, range);
+			// the last ranges are running elsewhere, nothing left to steal //
+			else SDL_Delay(1);
+		}
+
+		SDL_LockMutex(pool->lock);
+	}
+	SDL_UnlockMutex(pool->lock);
+	return 0;
+}
+
+
+// Create pool and start its workers //
+Work_Pool *Work_Pool_Create(int threads) {
+
+	if (threads < 1) threads = 1;
+	if (threads > POOL_MAX_THREADS) threads = POOL_MAX_THREADS;
+	Work_Pool *pool = SDL_malloc(sizeof(Work_Pool));
+	if (!pool) {
+		SDL_SetError("Failed to allocate memory for work pool.");
+		return NULL;
+	}
+	*pool = (Work_Pool) {
+		.lock = SDL_CreateMutex(),
+		.work = SDL_CreateCond(),
+		.done = SDL_CreateCond()
+	};
+	if (!pool->lock || !pool->work || !pool->done) {
+		Work_Pool_Destroy(pool);
+		return NULL;
+	}
+	for (int i = 0; i < threads; ++i) {
+		Work_Worker *worker_state = &pool->workers[i];
+		*worker_state = (Work_Worker) {.pool = pool, .index = i};
+		worker_state->thread = SDL_CreateThread(worker, "worker", worker_state);
+		if (!worker_state->thread) break;
+		++pool->thread_count;
+	}
+	if (pool->thread_count == 0) {
+		Work_Pool_Destroy(pool);
+		return NULL;
+	}
+	return pool;
+}
+
+
+// Destroy pool, it must not be running a loop //
+void Work_Pool_Destroy(Work_Pool *pool) {
+
+	if (!pool) return;
+	if (pool->lock) {
+		SDL_LockMutex(pool->lock);
+		pool->quit = true;
+		SDL_CondBroadcast(pool->work);
+		SDL_UnlockMutex(pool->lock);
+	}
+	for (int i = 0; i < pool->thread_count; ++i) SDL_WaitThread(pool->workers[i].thread, NULL);
+	SDL_DestroyCond(pool->done);
+	SDL_DestroyCond(pool->work);
+	SDL_DestroyMutex(pool->lock);
+	SDL_free(pool);
+}
+
+
+// Calls fn for every index below count across the workers, returns once all are done, false if count is over POOL_MAX_COUNT //
+bool Work_Pool_For(Work_Pool *pool, Uint32 count, Uint32 grain, Work_Fn fn, void *data) {
+
+	if (count > POOL_MAX_COUNT) {
+		SDL_SetError("Work pool loops are limited to %d indices.", POOL_MAX_COUNT);
+		return false;
+	}
+	if (count == 0) return true;
+	SDL_LockMutex(pool->lock);
+	pool->fn = fn;
+	pool->data = data;
+	pool->grain = grain < 1 ? 1 : grain;
+	SDL_AtomicSet(&pool->remaining, count);
+
+	// every worker starts with an equal share, stealing evens out the rest //
+	const Uint32 share = count / pool->thread_count, extra = count % pool->thread_count;
+	Uint32 first = 0;
+	for (int i = 0; i < pool->thread_count; ++i) {
+		const Uint32 last = first + share + (i < (int)extra);
+		if (last > first) push(&pool->deques[i], (Work_Range) {first, last});
+		first = last;
+	}
+	++pool->generation;
+	SDL_CondBroadcast(pool->work);
+	while (SDL_AtomicGet(&pool->remaining) > 0) SDL_CondWait(pool->done, pool->lock);
+	SDL_UnlockMutex(pool->lock);
+	return true;
+}
@@ -0,0 +1,71 @@
+///////////////////////////|
+//|File: pool.h
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+//----------------------------------------------------------------
+
+#ifndef POOL_H
+#define POOL_H
+
+#include <stdbool.h>
+
+#define POOL_MAX_THREADS 64
+#define POOL_MAX_COUNT SDL_MAX_SINT32	// most indices one loop can run, the count left is an atomic int
+#define POOL_DEQUE 64			// ranges one worker can hold, a split range leaves at most one per halving
+#define POOL_LINE 64			// cache line, deques are padded so two workers never share one
+
+typedef struct Work_Pool Work_Pool;
+
+// Runs one index of a parallel loop, worker is the calling thread's number from 0 //
+typedef void (*Work_Fn)(void *data, int worker, Uint32 index);
+
+// Indices first to last, not including last //
+typedef struct {
+	Uint32 first, last;
+} Work_Range;
+
+// One worker's ranges, the owner works from the bottom and thieves take from the top //
+typedef struct {
+	SDL_SpinLock lock;
+	Uint32 top, bottom;
+	Work_Range ranges[POOL_DEQUE];
+	Uint8 padding[POOL_LINE];
+} Work_Deque;
+
+// One worker thread //
+typedef struct {
+	Work_Pool *pool;
+	SDL_Thread *thread;
+	int index;					// also its deque
+} Work_Worker;
+
+// Worker threads sharing out a loop by stealing from each other //
+struct Work_Pool {
+	Work_Deque deques[POOL_MAX_THREADS];
+	Work_Worker workers[POOL_MAX_THREADS];
+	int thread_count;
+	SDL_mutex *lock;
+	SDL_cond *work;				// signalled when a loop starts or on quit
+	SDL_cond *done;				// signalled when the last index finishes
+	Uint32 generation;			// loops started, workers wake when it changes
+	bool quit;
+
+	// the running loop //
+	Work_Fn fn;
+	void *data;
+	Uint32 grain;				// ranges this small are run instead of split
+	SDL_atomic_t remaining;		// indices not finished yet
+	SDL_atomic_t steals;		// ranges taken from another worker
+};
+
+Work_Pool *Work_Pool_Create(int threads);
+
+void Work_Pool_Destroy(Work_Pool *pool);
+
+bool Work_Pool_For(Work_Pool *pool, Uint32 count, Uint32 grain, Work_Fn fn, void *data);
+
+#endif
@@ -0,0 +1,233 @@
+///////////////////////////|
+//|File: profiler.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Times each stage of a frame on the performance counter. Per-frame
+ * totals go into a ring buffer for the min/avg/p99 overlay, and every
+ * zone is kept as a trace event that can be written out in the Chrome
+ * trace format and opened in chrome://tracing or Perfetto.
+ * Zones can be recorded from any thread, the simulation thread's
+ * steps count towards the frame that is open when they finish, and
+ * each thread gets its own track in the trace.
+ * Input latency, from a key event to the present that first shows it,
+ * is kept per event beside the zones and traced as its own track.
+ */
+
+//----------------------------------------------------------------
+
+// Includes //
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+// SDL2 //
+#include <SDL2/SDL.h>
+
+// Header Files //
+#include "font.h"
+#include "profiler.h"
+
+// One timed zone for the trace //
+typedef struct {
+	Uint64 start, duration;
+	const char *name;
+	int thread;			// trace track, 1 for the thread that enabled profiling, then in the order threads first record
+} Trace_Event;
+
+// Input latency gets a track past every thread's //
+#define INPUT_TRACK (PROFILE_THREADS + 1)
+
+static const char *zone_names[PROFILE_ZONES] = {
+	"frame", "events", "physics", "collision", "background", "text", "ship", "rocks", "particles", "upload", "present", "pacing"
+};
+
+static bool enabled;
+static SDL_threadID threads[PROFILE_THREADS];	// track of each thread, less one
+static int thread_count;
+static SDL_SpinLock lock;					// guards the frames and the trace
+static Uint64 origin;						// counter value at enable, trace times are relative to it
+static Uint64 frame_start;
+
+// per-frame totals, frames[current] is still being filled //
+static Uint64 frames[PROFILE_FRAMES][PROFILE_ZONES];
+static int current, filled;
+
+static Trace_Event trace[PROFILE_TRACE_EVENTS];
+static size_t trace_count;					// total recorded, wraps in the buffer
+
+// latest input latencies, inputs[input_count % PROFILE_INPUTS] is the oldest once full //
+static Uint64 inputs[PROFILE_INPUTS];
+static size_t input_count;
+
+
+// Starts or stops recording, the first enable starts the clock //
+void Profiler_Enable(bool enable) {
+
+	if (enable && !origin) {
+		threads[0] = SDL_ThreadID();
+		thread_count = 1;
+		origin = SDL_GetPerformanceCounter();
+		frame_start = origin;
+	}
+	enabled = enable;
+}
+
+
+// Trace track of the calling thread, called with the lock held //
+static int thread_track(void) {
+
+	const SDL_threadID id = SDL_ThreadID();
+	for (int i = 0; i < thread_count; ++i) {
+		if (threads[i] == id) return i + 1;
+	}
+	if (thread_count < PROFILE_THREADS) threads[thread_count++] = id;
+	return thread_count;
+}
+
+
+// Start of a zone, pass the result to Profiler_End //
+Uint64 Profiler_Begin(void) {
+	return enabled ? SDL_GetPerformanceCounter() : 0;
+}
+
+
+// End of a zone, adds it to this frame's total and the trace //
+void Profiler_End(Profile_Zone zone, Uint64 start) {
+
+	if (!enabled || !start) return;
+	const Uint64 duration = SDL_GetPerformanceCounter() - start;
+	SDL_AtomicLock(&lock);
+	const int thread = thread_track();
+	frames[current][zone] += duration;
+	trace[trace_count++ % PROFILE_TRACE_EVENTS] = (Trace_Event) {start, duration, zone_names[zone], thread};
+	SDL_AtomicUnlock(&lock);
+}
+
+
+// Records the time from an input to the present that first showed it //
+void Profiler_Input(Uint64 input, Uint64 presented) {
+
+	if (!enabled || presented < input) return;
+	SDL_AtomicLock(&lock);
+	inputs[input_count++ % PROFILE_INPUTS] = presented - input;
+	trace[trace_count++ % PROFILE_TRACE_EVENTS] = (Trace_Event) {input, presented - input, "input", INPUT_TRACK};
+	SDL_AtomicUnlock(&lock);
+}
+
+
+// Closes the current frame and starts the next //
+void Profiler_Frame(void) {
+
+	if (!enabled) return;
+	Profiler_End(PROFILE_FRAME, frame_start);
+	frame_start = SDL_GetPerformanceCounter();
+	SDL_AtomicLock(&lock);
+	current = (current + 1) % PROFILE_FRAMES;
+	if (filled < PROFILE_FRAMES) ++filled;
+	SDL_memset(frames[current], 0, sizeof(frames[current]));
+	SDL_AtomicUnlock(&lock);
+}
+
+
+static int compare_ticks(const void *a, const void *b) {
+	const Uint64 x = *(const Uint64 *)a, y = *(const Uint64 *)b;
+	return (x > y) - (x < y);
+}
+
+
+// Draws min/avg/p99 of every zone over the finished frames, in milliseconds //
+void Profiler_Render(Font *font, SDL_Renderer *renderer) {
+
+	if (filled == 0) return;
+	const double ms = 1000.0 / SDL_GetPerformanceFrequency();
+	char text[64 * (PROFILE_ZONES + 2)];
+	int length = SDL_snprintf(text, sizeof(text), "ZONE         MIN   AVG   P99\n");
+	SDL_AtomicLock(&lock);
+	for (int zone = 0; zone < PROFILE_ZONES; ++zone) {
+		Uint64 samples[PROFILE_FRAMES], total = 0;
+		for (int i = 0; i < filled; ++i) {
+			// skip the frame still being filled //
+			samples[i] = frames[(current + PROFILE_FRAMES - 1 - i) % PROFILE_FRAMES][zone];
+			total += samples[i];
+		}
+		qsort(samples, filled, sizeof(Uint64), compare_ticks);
+		length += SDL_snprintf(
+			text + length, sizeof(text) - length, "%-10s %5.2f %5.2f %5.2f\n", zone_names[zone],
+			samples[0] * ms, (double)total / filled * ms, samples[(filled - 1) * 99 / 100] * ms
+		);
+	}
+
+	// input latency is per key event rather than per frame //
+	const int count = input_count < PROFILE_INPUTS ? input_count : PROFILE_INPUTS;
+	if (count > 0) {
+		Uint64 samples[PROFILE_INPUTS], total = 0;
+		for (int i = 0; i < count; ++i) total += samples[i] = inputs[i];
+		qsort(samples, count, sizeof(Uint64), compare_ticks);
+		length += SDL_snprintf(
+			text + length, sizeof(text) - length, "%-10s %5.2f %5.2f %5.2f\n", "input",
+			samples[0] * ms, (double)total / count * ms, samples[(count - 1) * 99 / 100] * ms
+		);
+	} else {
+		length += SDL_snprintf(text + length, sizeof(text) - length, "%-10s     -     -     -\n", "input");
+	}
+	SDL_AtomicUnlock(&lock);
+
+	// dim what is behind the text so it stays readable //
+	const SDL_Rect panel = {0, 16, 8 * 29, 8 * (PROFILE_ZONES + 2)};
+	Uint8 r, g, b, a;
+	SDL_BlendMode blend;
+	SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+	SDL_GetRenderDrawBlendMode(renderer, &blend);
+	SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+	SDL_SetRenderDrawColor(renderer, 0, 0, 0, 192);
+	SDL_RenderFillRect(renderer, &panel);
+	SDL_SetRenderDrawColor(renderer, r, g, b, a);
+	SDL_SetRenderDrawBlendMode(renderer, blend);
+	const SDL_Point point = {panel.x, panel.y};
+	Font_renderText(font, renderer, &point, text);
+}
+
+
+// Writes the recorded zones as Chrome trace events //
+bool Profiler_WriteTrace(const char *path) {
+
+	FILE *file = fopen(path, "w");
+	if (!file) {
+		SDL_SetError("Could not open %s for writing.", path);
+		return false;
+	}
+	const double us = 1000000.0 / SDL_GetPerformanceFrequency();
+	const size_t count = trace_count < PROFILE_TRACE_EVENTS ? trace_count : PROFILE_TRACE_EVENTS;
+	fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+	// name every track first, the thread that enabled profiling is the main one //
+	for (int i = 0; i < thread_count; ++i) {
+		fprintf(
+			file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"thread %d%s\"}},\n",
+			i + 1, i + 1, i == 0 ? " (main)" : ""
+		);
+	}
+	fprintf(
+		file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"input latency\"}}%s\n",
+		INPUT_TRACK, count ? "," : ""
+	);
+	for (size_t i = 0; i < count; ++i) {
+		const Trace_Event *event = &trace[(trace_count - count + i) % PROFILE_TRACE_EVENTS];
+		fprintf(
+			file, "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}%s\n",
+			event->name, event->thread, (event->start - origin) * us, event->duration * us, i + 1 < count ? "," : ""
+		);
+	}
+	fprintf(file, "]}\n");
+	if (fclose(file) != 0) {
+		SDL_SetError("Could not write %s.", path);
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,54 @@
+///////////////////////////|
+//|File: profiler.h
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+//----------------------------------------------------------------
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdbool.h>
+
+#include "font.h"
+
+#define PROFILE_FRAMES 240				// frames kept for the overlay statistics
+#define PROFILE_TRACE_EVENTS 65536		// zones kept for the trace, oldest are dropped
+#define PROFILE_INPUTS 64				// input latencies kept for the overlay statistics
+#define PROFILE_THREADS 64				// threads given their own trace track, any more share the last
+
+// Timed stages of a frame //
+typedef enum {
+	PROFILE_FRAME,
+	PROFILE_EVENTS,
+	PROFILE_PHYSICS,
+	PROFILE_COLLISION,
+	PROFILE_BACKGROUND,
+	PROFILE_TEXT,
+	PROFILE_SHIP,
+	PROFILE_ROCKS,
+	PROFILE_PARTICLES,
+	PROFILE_UPLOAD,
+	PROFILE_PRESENT,
+	PROFILE_PACING,
+	PROFILE_ZONES
+} Profile_Zone;
+
+void Profiler_Enable(bool enabled);
+
+Uint64 Profiler_Begin(void);
+
+void Profiler_End(Profile_Zone zone, Uint64 start);
+
+void Profiler_Frame(void);
+
+void Profiler_Input(Uint64 input, Uint64 presented);
+
+void Profiler_Render(Font *font, SDL_Renderer *renderer);
+
+bool Profiler_WriteTrace(const char *path);
+
+#endif
@@ -0,0 +1,100 @@
+///////////////////////////|
+//|File: quad.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Batches rectangles into one persistent vertex buffer so a whole
+ * layer is submitted with one SDL_RenderGeometry call.
+ */
+
+//----------------------------------------------------------------
+
+// SDL2 //
+#include <SDL2/SDL.h>
+
+// Header Files //
+#include "quad.h"
+
+
+// Create batch with room for capacity quads //
+Quad_Batch *Quad_Batch_Create(int capacity) {
+
+	if (capacity < 1) capacity = 1;
+	Quad_Batch *batch = SDL_malloc(sizeof(Quad_Batch));
+	if (!batch) {
+		SDL_SetError("Failed to allocate memory for quad batch.");
+		return NULL;
+	}
+	*batch = (Quad_Batch) {
+		.vertices = SDL_malloc(capacity * 4 * sizeof(SDL_Vertex)),
+		.indices = SDL_malloc(capacity * 6 * sizeof(int)),
+		.capacity = capacity
+	};
+	if (!batch->vertices || !batch->indices) {
+		Quad_Batch_Destroy(batch);
+		SDL_SetError("Failed to allocate memory for %d quads.", capacity);
+		return NULL;
+	}
+
+	// two triangles per quad, the pattern never changes //
+	for (int i = 0; i < capacity; ++i) {
+		int *index = batch->indices + i * 6;
+		int vertex = i * 4;
+		index[0] = vertex;
+		index[1] = vertex + 1;
+		index[2] = vertex + 2;
+		index[3] = vertex + 2;
+		index[4] = vertex + 3;
+		index[5] = vertex;
+	}
+	return batch;
+}
+
+
+// Destroy batch //
+void Quad_Batch_Destroy(Quad_Batch *batch) {
+	if (!batch) return;
+	SDL_free(batch->vertices);
+	SDL_free(batch->indices);
+	SDL_free(batch);
+}
+
+
+// Drops every queued quad //
+void Quad_Batch_Clear(Quad_Batch *batch) {
+	batch->count = 0;
+}
+
+
+// Queues a textured quad, uv is in normalized texture coordinates //
+bool Quad_Batch_AddTextured(Quad_Batch *batch, const SDL_FRect *dst, const SDL_FRect *uv, SDL_Color color) {
+
+	if (batch->count >= batch->capacity) return false;
+	SDL_Vertex *vertex = batch->vertices + batch->count++ * 4;
+	const float x0 = dst->x, y0 = dst->y, x1 = dst->x + dst->w, y1 = dst->y + dst->h;
+	const float u0 = uv->x, v0 = uv->y, u1 = uv->x + uv->w, v1 = uv->y + uv->h;
+	vertex[0] = (SDL_Vertex) {{x0, y0}, color, {u0, v0}};
+	vertex[1] = (SDL_Vertex) {{x1, y0}, color, {u1, v0}};
+	vertex[2] = (SDL_Vertex) {{x1, y1}, color, {u1, v1}};
+	vertex[3] = (SDL_Vertex) {{x0, y1}, color, {u0, v1}};
+	return true;
+}
+
+
+// Queues a solid quad //
+bool Quad_Batch_AddRect(Quad_Batch *batch, const SDL_FRect *dst, SDL_Color color) {
+	static const SDL_FRect no_uv = {0};
+	return Quad_Batch_AddTextured(batch, dst, &no_uv, color);
+}
+
+
+// Draws every queued quad in one call, texture may be NULL for solid quads //
+int Quad_Batch_Render(Quad_Batch *batch, SDL_Renderer *renderer, SDL_Texture *texture) {
+	if (batch->count == 0) return 0;
+	return SDL_RenderGeometry(renderer, texture, batch->vertices, batch->count * 4, batch->indices, batch->count * 6);
+}
@@ -0,0 +1,36 @@
+///////////////////////////|
+//|File: quad.h
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+//----------------------------------------------------------------
+
+#ifndef QUAD_H
+#define QUAD_H
+
+#include <stdbool.h>
+
+// Quads collected into one vertex and index buffer, drawn with a single call //
+typedef struct {
+	SDL_Vertex *vertices;	// four per quad, rewritten every frame
+	int *indices;			// six per quad, filled once at creation
+	int capacity;			// max quads
+	int count;				// quads queued since the last clear
+} Quad_Batch;
+
+Quad_Batch *Quad_Batch_Create(int capacity);
+
+void Quad_Batch_Destroy(Quad_Batch *batch);
+
+void Quad_Batch_Clear(Quad_Batch *batch);
+
+bool Quad_Batch_AddRect(Quad_Batch *batch, const SDL_FRect *dst, SDL_Color color);
+
+bool Quad_Batch_AddTextured(Quad_Batch *batch, const SDL_FRect *dst, const SDL_FRect *uv, SDL_Color color);
+
+int Quad_Batch_Render(Quad_Batch *batch, SDL_Renderer *renderer, SDL_Texture *texture);
+
+#endif
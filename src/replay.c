@@ -0,0 +1,143 @@
+///////////////////////////|
+//|File: replay.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Records the seed and every input transition of a session so it can
+ * be played back exactly. Events are 8 bytes and only written when the
+ * input changes, so a long session stays small.
+ */
+
+//----------------------------------------------------------------
+
+// Includes //
+#include <stdio.h>
+#include <stdbool.h>
+
+// SDL2 //
+#include <SDL2/SDL.h>
+
+// Header Files //
+#include "replay.h"
+
+#define INITIAL_EVENTS 256
+
+
+// Create an empty replay //
+Replay *Replay_Create(Uint64 seed, Uint32 tick_rate, Uint32 rock_count, Uint32 flags) {
+
+	Replay *replay = SDL_malloc(sizeof(Replay));
+	if (!replay) {
+		SDL_SetError("Failed to allocate memory for replay.");
+		return NULL;
+	}
+	*replay = (Replay) {
+		.header = {
+			.version = REPLAY_VERSION,
+			.tick_rate = tick_rate,
+			.rock_count = rock_count,
+			.flags = flags,
+			.seed = seed
+		}
+	};
+	SDL_memcpy(replay->header.magic, REPLAY_MAGIC, 4);
+	return replay;
+}
+
+
+// Destroy replay //
+void Replay_Destroy(Replay *replay) {
+	if (!replay) return;
+	SDL_free(replay->events);
+	SDL_free(replay);
+}
+
+
+// Appends an event, growing the event list as needed //
+bool Replay_Record(Replay *replay, Uint32 tick, Uint8 type, int direction) {
+
+	Replay_Header *header = &replay->header;
+	if (header->event_count == replay->capacity) {
+		size_t capacity = replay->capacity ? replay->capacity * 2 : INITIAL_EVENTS;
+		Replay_Event *events = SDL_realloc(replay->events, capacity * sizeof(Replay_Event));
+		if (!events) {
+			SDL_SetError("Failed to allocate memory for %lu replay events.", (unsigned long)capacity);
+			return false;
+		}
+		replay->events = events;
+		replay->capacity = capacity;
+	}
+	replay->events[header->event_count++] = (Replay_Event) {.tick = tick, .type = type, .direction = direction};
+	if (tick > header->ticks) header->ticks = tick;
+	return true;
+}
+
+
+// Writes the header and events //
+bool Replay_Save(const Replay *replay, const char *path) {
+
+	FILE *file = fopen(path, "wb");
+	if (!file) {
+		SDL_SetError("Could not open %s for writing.", path);
+		return false;
+	}
+	const Uint32 count = replay->header.event_count;
+	bool written = fwrite(&replay->header, sizeof(Replay_Header), 1, file) == 1 &&
+		fwrite(replay->events, sizeof(Replay_Event), count, file) == count;
+	if (fclose(file) != 0) written = false;
+	if (!written) SDL_SetError("Could not write %s.", path);
+	return written;
+}
+
+
+// Reads a replay written by Replay_Save //
+Replay *Replay_Load(const char *path) {
+
+	FILE *file = fopen(path, "rb");
+	if (!file) {
+		SDL_SetError("Could not open %s.", path);
+		return NULL;
+	}
+	Replay_Header header;
+	if (
+		fread(&header, sizeof(header), 1, file) != 1 ||
+		SDL_memcmp(header.magic, REPLAY_MAGIC, 4) != 0 ||
+		header.version != REPLAY_VERSION ||
+		header.tick_rate == 0
+	) {
+		fclose(file);
+		SDL_SetError("%s is not a version %d replay.", path, REPLAY_VERSION);
+		return NULL;
+	}
+	Replay *replay = Replay_Create(header.seed, header.tick_rate, header.rock_count, header.flags);
+	if (!replay) {
+		fclose(file);
+		return NULL;
+	}
+	replay->header = header;
+	replay->capacity = header.event_count;
+	replay->events = SDL_malloc((header.event_count ? header.event_count : 1) * sizeof(Replay_Event));
+	if (!replay->events || fread(replay->events, sizeof(Replay_Event), header.event_count, file) != header.event_count) {
+		fclose(file);
+		Replay_Destroy(replay);
+		SDL_SetError("%s is truncated.", path);
+		return NULL;
+	}
+	fclose(file);
+
+	// events must come in tick order and end with the session //
+	for (Uint32 i = 0; i < header.event_count; ++i) {
+		const Uint32 tick = replay->events[i].tick;
+		if (tick > header.ticks || (i > 0 && tick < replay->events[i - 1].tick)) {
+			Replay_Destroy(replay);
+			SDL_SetError("%s has an event out of order at tick %u.", path, tick);
+			return NULL;
+		}
+	}
+	return replay;
+}
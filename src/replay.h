@@ -0,0 +1,64 @@
+///////////////////////////|
+//|File: replay.h
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+//----------------------------------------------------------------
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <stdbool.h>
+
+#define REPLAY_MAGIC "SDRP"
+#define REPLAY_VERSION 3		// 2: hits use the ship's pixels, 3: hits are swept over each step and end the game at the impact
+
+// Header flags //
+#define REPLAY_INVULNERABLE 0x1		// recorded with --stress, hits never end the game
+
+// Event types //
+#define REPLAY_DIRECTION 1		// ship direction changed
+#define REPLAY_RESET 2			// a new game started with the next seed
+
+// Replay file header //
+typedef struct {
+	char magic[4];			// REPLAY_MAGIC
+	Uint32 version;			// REPLAY_VERSION
+	Uint32 tick_rate;		// simulation steps per second
+	Uint32 rock_count;		// asteroids in play
+	Uint32 flags;			// REPLAY_ flags
+	Uint32 ticks;			// steps simulated over the whole session
+	Uint32 event_count;		// events following the header
+	Uint32 reserved;
+	Uint64 seed;			// every game's seed is drawn from this in order
+} Replay_Header;
+
+// One input transition, applied before the step it was recorded at //
+typedef struct {
+	Uint32 tick;			// steps simulated since the session started
+	Uint8 type;				// REPLAY_DIRECTION or REPLAY_RESET
+	Sint8 direction;		// new ship direction
+	Uint16 reserved;
+} Replay_Event;
+
+// Replay being recorded or played back //
+typedef struct {
+	Replay_Header header;
+	Replay_Event *events;
+	size_t capacity;
+} Replay;
+
+Replay *Replay_Create(Uint64 seed, Uint32 tick_rate, Uint32 rock_count, Uint32 flags);
+
+void Replay_Destroy(Replay *replay);
+
+bool Replay_Record(Replay *replay, Uint32 tick, Uint8 type, int direction);
+
+bool Replay_Save(const Replay *replay, const char *path);
+
+Replay *Replay_Load(const char *path);
+
+#endif
@@ -0,0 +1,247 @@
+///////////////////////////|
+//|File: scores.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Keeps the best scores in a versioned, checksummed file. A save writes a
+ * temporary file and renames it over the old one, so a crash leaves either
+ * the old or the new leaderboard and never a truncated one. Saves run on
+ * a background thread so the game never waits on the disk.
+ */
+
+//----------------------------------------------------------------
+
+// Includes //
+#include <stdio.h>
+#include <stdbool.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#define SCORES_FSYNC
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// SDL2 //
+#include <SDL2/SDL.h>
+
+// Header Files //
+#include "scores.h"
+
+// Size of the file written before the leaderboard, one native Sint32 //
+#define LEGACY_SIZE 4
+
+
+// FNV-1a over the entries //
+static Uint32 checksum(const Score_Entry *entries, Uint32 count) {
+
+	const Uint8 *byte = (const Uint8 *)entries;
+	Uint32 hash = 2166136261u;
+	for (size_t i = 0; i < count * sizeof(Score_Entry); ++i) {
+		hash ^= byte[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+
+// Loads the leaderboard, a missing file is an empty board //
+bool Leaderboard_Load(Leaderboard *board, const char *path) {
+
+	*board = (Leaderboard) {0};
+	FILE *file = fopen(path, "rb");
+	if (!file) return true;
+	Scores_Header header;
+	const size_t read = fread(&header, 1, sizeof(header), file);
+
+	// the old format was a bare high score, it becomes the only entry //
+	if (read == LEGACY_SIZE) {
+		fclose(file);
+		Sint32 legacy;
+		SDL_memcpy(&legacy, &header, LEGACY_SIZE);
+		if (legacy > 0) Leaderboard_Add(board, legacy, 0);
+		return true;
+	}
+	if (
+		read != sizeof(header) ||
+		SDL_memcmp(header.magic, SCORES_MAGIC, 4) != 0 ||
+		header.version != SCORES_VERSION ||
+		header.count > SCORES_MAX
+	) {
+		fclose(file);
+		SDL_SetError("%s is not a version %d scores file.", path, SCORES_VERSION);
+		return false;
+	}
+	const bool complete = fread(board->entries, sizeof(Score_Entry), header.count, file) == header.count;
+	fclose(file);
+	if (!complete || checksum(board->entries, header.count) != header.checksum) {
+		*board = (Leaderboard) {0};
+		SDL_SetError("%s is corrupt.", path);
+		return false;
+	}
+	board->count = header.count;
+	return true;
+}
+
+
+// Replaces path with the finished temporary file //
+static bool replace(const char *temp, const char *path) {
+
+#ifdef _WIN32
+	return MoveFileExA(temp, path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+#else
+	if (rename(temp, path) != 0) return false;
+#ifdef SCORES_FSYNC
+	// the rename itself is only durable once the directory is synced //
+	char dir[SCORES_PATH_MAX] = ".";
+	const char *slash = SDL_strrchr(path, '/');
+	const size_t length = slash > path ? (size_t)(slash - path) : 1;
+	if (slash && length < sizeof(dir)) {
+		SDL_memcpy(dir, path, length);
+		dir[length] = '\0';
+	}
+	int fd = open(dir, O_RDONLY);
+	if (fd >= 0) {
+		fsync(fd);
+		close(fd);
+	}
+#endif
+	return true;
+#endif
+}
+
+
+// Writes the leaderboard to a temporary file and renames it over path //
+bool Leaderboard_Save(const Leaderboard *board, const char *path) {
+
+	char temp[SCORES_PATH_MAX + 4];
+	if ((size_t)SDL_snprintf(temp, sizeof(temp), "%s.tmp", path) >= sizeof(temp)) {
+		SDL_SetError("Scores path %s is too long.", path);
+		return false;
+	}
+	FILE *file = fopen(temp, "wb");
+	if (!file) {
+		SDL_SetError("Could not open %s for writing.", temp);
+		return false;
+	}
+	Scores_Header header = {
+		.version = SCORES_VERSION,
+		.count = board->count,
+		.checksum = checksum(board->entries, board->count)
+	};
+	SDL_memcpy(header.magic, SCORES_MAGIC, 4);
+	bool written =
+		fwrite(&header, sizeof(header), 1, file) == 1 &&
+		fwrite(board->entries, sizeof(Score_Entry), board->count, file) == board->count &&
+		fflush(file) == 0;
+#ifdef SCORES_FSYNC
+	written = written && fsync(fileno(file)) == 0;
+#endif
+	written = fclose(file) == 0 && written;
+	if (!written || !replace(temp, path)) {
+		remove(temp);
+		SDL_SetError("Could not write %s.", path);
+		return false;
+	}
+	return true;
+}
+
+
+// Inserts a score in order, returns its rank from 0 or -1 if it did not make the board //
+int Leaderboard_Add(Leaderboard *board, Uint64 score, Sint64 time) {
+
+	Uint32 rank = 0;
+	while (rank < board->count && board->entries[rank].score >= score) ++rank;
+	if (rank >= SCORES_MAX) return -1;
+	const Uint32 moved = (board->count < SCORES_MAX ? board->count : SCORES_MAX - 1) - rank;
+	SDL_memmove(&board->entries[rank + 1], &board->entries[rank], moved * sizeof(Score_Entry));
+	board->entries[rank] = (Score_Entry) {score, time};
+	if (board->count < SCORES_MAX) ++board->count;
+	return rank;
+}
+
+
+// Highest score, 0 on an empty board //
+Uint64 Leaderboard_Best(const Leaderboard *board) {
+	return board->count ? board->entries[0].score : 0;
+}
+
+
+// Writer thread, saves the latest submitted board until told to quit //
+static int writer_thread(void *data) {
+
+	Score_Writer *writer = data;
+	SDL_LockMutex(writer->lock);
+	for (;;) {
+		while (!writer->dirty && !writer->quit) SDL_CondWait(writer->wake, writer->lock);
+		if (!writer->dirty) break;
+		Leaderboard board = writer->pending;
+		writer->dirty = false;
+		SDL_UnlockMutex(writer->lock);
+
+		if (!Leaderboard_Save(&board, writer->path)) fprintf(stderr, "Could not save scores: %s\n", SDL_GetError());
+
+		SDL_LockMutex(writer->lock);
+	}
+	SDL_UnlockMutex(writer->lock);
+	return 0;
+}
+
+
+// Create writer and start its thread //
+Score_Writer *Score_Writer_Create(const char *path) {
+
+	Score_Writer *writer = SDL_malloc(sizeof(Score_Writer));
+	if (!writer) {
+		SDL_SetError("Failed to allocate memory for score writer.");
+		return NULL;
+	}
+	*writer = (Score_Writer) {
+		.lock = SDL_CreateMutex(),
+		.wake = SDL_CreateCond()
+	};
+	if (SDL_strlcpy(writer->path, path, sizeof(writer->path)) >= sizeof(writer->path)) {
+		SDL_SetError("Scores path %s is too long.", path);
+		Score_Writer_Destroy(writer);
+		return NULL;
+	}
+	if (!writer->lock || !writer->wake || !(writer->thread = SDL_CreateThread(writer_thread, "scores", writer))) {
+		Score_Writer_Destroy(writer);
+		return NULL;
+	}
+	return writer;
+}
+
+
+// Destroy writer, a board still waiting is saved first //
+void Score_Writer_Destroy(Score_Writer *writer) {
+
+	if (!writer) return;
+	if (writer->thread) {
+		SDL_LockMutex(writer->lock);
+		writer->quit = true;
+		SDL_CondSignal(writer->wake);
+		SDL_UnlockMutex(writer->lock);
+		SDL_WaitThread(writer->thread, NULL);
+	}
+	SDL_DestroyCond(writer->wake);
+	SDL_DestroyMutex(writer->lock);
+	SDL_free(writer);
+}
+
+
+// Hands a copy of the board to the writer, never waits on the disk //
+void Score_Writer_Submit(Score_Writer *writer, const Leaderboard *board) {
+
+	SDL_LockMutex(writer->lock);
+	writer->pending = *board;
+	writer->dirty = true;
+	SDL_CondSignal(writer->wake);
+	SDL_UnlockMutex(writer->lock);
+}
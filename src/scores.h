@@ -0,0 +1,68 @@
+///////////////////////////|
+//|File: scores.h
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+//----------------------------------------------------------------
+
+#ifndef SCORES_H
+#define SCORES_H
+
+#include <stdbool.h>
+
+// File layout //
+#define SCORES_FILE "scores"
+#define SCORES_MAGIC "SDHS"
+#define SCORES_VERSION 1
+#define SCORES_MAX 10			// entries kept on the leaderboard
+#define SCORES_PATH_MAX 256
+
+// One finished game //
+typedef struct {
+	Uint64 score;
+	Sint64 time;		// when the game ended, seconds since the epoch, 0 if unknown
+} Score_Entry;
+
+// Scores file header, the entries follow it //
+typedef struct {
+	char magic[4];		// SCORES_MAGIC
+	Uint32 version;		// SCORES_VERSION
+	Uint32 count;		// entries following the header
+	Uint32 checksum;	// FNV-1a of the entries
+} Scores_Header;
+
+// Best scores, highest first //
+typedef struct {
+	Score_Entry entries[SCORES_MAX];
+	Uint32 count;
+} Leaderboard;
+
+// Saves leaderboards on a background thread //
+typedef struct {
+	SDL_Thread *thread;
+	SDL_mutex *lock;
+	SDL_cond *wake;			// signalled when a board is submitted or on quit
+	Leaderboard pending;	// latest submitted board, older unsaved ones are skipped
+	bool dirty;				// pending has not been saved yet
+	bool quit;
+	char path[SCORES_PATH_MAX];
+} Score_Writer;
+
+bool Leaderboard_Load(Leaderboard *board, const char *path);
+
+bool Leaderboard_Save(const Leaderboard *board, const char *path);
+
+int Leaderboard_Add(Leaderboard *board, Uint64 score, Sint64 time);
+
+Uint64 Leaderboard_Best(const Leaderboard *board);
+
+Score_Writer *Score_Writer_Create(const char *path);
+
+void Score_Writer_Destroy(Score_Writer *writer);
+
+void Score_Writer_Submit(Score_Writer *writer, const Leaderboard *board);
+
+#endif
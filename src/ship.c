@@ -21,16 +21,15 @@
 #include "ship.h"
 #include "shared.h"
 
-// Create player ship //
-Space_Ship *Space_Ship_Create(SDL_Renderer *renderer) {
+// Create player ship, takes ownership of its tilesheet //
+Space_Ship *Space_Ship_Create(TileSheet *tiles) {
 	Space_Ship *ship = malloc(sizeof(Space_Ship));
-	ship->tiles = TileSheet_create("Images/ship.bmp", renderer, 16, 16, TILESHEET_CREATETEXTURE);
-	if (!ship->tiles) {
-		free(ship);
+	if (!ship) {
+		TileSheet_destroy(tiles);
+		SDL_SetError("Failed to allocate memory for ship.");
 		return NULL;
 	}
-	
-	Space_Ship_Reset(ship);
+	ship->tiles = tiles;
 	return ship;
 }
 
@@ -40,14 +39,9 @@ void Space_Ship_Destroy(Space_Ship *ship) {
 	free(ship);
 }
 
-void Space_Ship_Reset(Space_Ship *ship) {
-	ship->direction = 0;
-    ship->position = WIDTH / 2;
-}
-
 // Draws/renders player ship //
-void Space_Ship_Render(Space_Ship *ship, SDL_Renderer *renderer) {
-    SDL_Rect dst_rect = {ship->position, HEIGHT - 25, ship->tiles->tile_width, ship->tiles->tile_height};
+void Space_Ship_Render(Space_Ship *ship, SDL_Renderer *renderer, float position) {
+    SDL_Rect dst_rect = {position, SHIP_Y, ship->tiles->tile_width, ship->tiles->tile_height};
     SDL_Rect src_rect = TileSheet_getTileRect(ship->tiles, 0);
 	SDL_RenderCopy(renderer, ship->tiles->texture, &src_rect, &dst_rect);
 }
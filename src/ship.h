@@ -14,18 +14,19 @@
 // max speed // 
 #define SHIP_VELOCITY 130
 
+// size and height of the ship on screen //
+#define SHIP_WIDTH 16
+#define SHIP_HEIGHT 16
+#define SHIP_Y (HEIGHT - 25)
+
 typedef struct {
     TileSheet *tiles; 	// tilesheet for ship
-    int direction; 		// current direction of ship movement
-    float position; 	// current position of the ship
 } Space_Ship;
 
-Space_Ship *Space_Ship_Create(SDL_Renderer *renderer);
+Space_Ship *Space_Ship_Create(TileSheet *tiles);
 
 void Space_Ship_Destroy(Space_Ship *ship);
 
-void Space_Ship_Reset(Space_Ship *ship);
-
-void Space_Ship_Render(Space_Ship *ship, SDL_Renderer *renderer);
+void Space_Ship_Render(Space_Ship *ship, SDL_Renderer *renderer, float position);
 
 #endif
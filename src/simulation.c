@@ -0,0 +1,279 @@
+///////////////////////////|
+//|File: simulation.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Runs the game's fixed steps on their own thread so rendering and
+ * presenting never hold up the simulation. Input arrives on a single
+ * producer, single consumer command ring and each step's result is
+ * published through a triple buffer. Neither side ever waits on the other.
+ * Commands carry the time they happened, so a key press lands on the step
+ * nearest to it however late the main thread got to it.
+ */
+
+//----------------------------------------------------------------
+
+// Includes //
+#include <stdio.h>
+#include <stdbool.h>
+
+// SDL2 //
+#include <SDL2/SDL.h>
+
+// Header Files //
+#include "tilesheet.h"
+#include "ship.h"
+#include "game.h"
+#include "replay.h"
+#include "quad.h"
+#include "simulation.h"
+#include "shared.h"
+
+// Set in latest while the snapshot it names has not been read //
+#define SIM_FRESH 0x4
+
+
+// Adds an input transition to the recording //
+static void record(Simulation *sim, Uint8 type) {
+	if (sim->recording && !Replay_Record(sim->recording, sim->tick, type, sim->game->ship_direction)) {
+		fprintf(stderr, "Stopped recording: %s\n", SDL_GetError());
+		Replay_Destroy(sim->recording);
+		sim->recording = NULL;
+	}
+}
+
+
+// Applies queued commands in order up to the first one after due, returns true if any were applied //
+static bool drain(Simulation *sim, Uint64 due) {
+
+	int index = SDL_AtomicGet(&sim->tail);
+	const int end = SDL_AtomicGet(&sim->head);
+	const int first = index;
+	for (; index != end; ++index) {
+		const Sim_Command *command = &sim->commands[index & (SIM_QUEUE - 1)];
+		if (command->time > due) break;
+		switch (command->type) {
+			case SIM_DIRECTION: {
+				sim->game->ship_direction = command->direction;
+				++sim->inputs;
+				record(sim, REPLAY_DIRECTION);
+			} break;
+			case SIM_RESET: {
+				// the first game starts with the session, only the later ones are recorded //
+				if (sim->games++) record(sim, REPLAY_RESET);
+				Game_Init(sim->game, command->seed);
+				sim->running = false;
+			} break;
+			case SIM_START: {
+				sim->running = true;
+			} break;
+		}
+	}
+	SDL_AtomicSet(&sim->tail, index);
+	return index != first;
+}
+
+
+// Copies the game into the back snapshot and swaps it with the latest //
+static void publish(Simulation *sim) {
+
+	Snapshot *snapshot = &sim->snapshots[sim->back];
+	const Game *game = sim->game;
+	const Asteroid_Field *rocks = game->rocks;
+	Uint32 count = 0;
+	for (size_t i = 0; i < rocks->count; ++i) {
+		// rocks only fall, so this is anything drawn between the two steps //
+		if (rocks->y[i] + rocks->size[i] <= 0 || rocks->prev_y[i] >= HEIGHT) continue;
+		snapshot->rock_x[count] = rocks->x[i];
+		snapshot->rock_y[count] = rocks->y[i];
+		snapshot->rock_prev_y[count] = rocks->prev_y[i];
+		snapshot->rock_size[count] = rocks->size[i];
+		++count;
+	}
+	snapshot->rock_count = count;
+	snapshot->game = sim->games;
+	snapshot->running = sim->running;
+	snapshot->over = game->over;
+	snapshot->ship_position = game->ship_position;
+	snapshot->prev_ship_position = game->prev_ship_position;
+	snapshot->score = Game_Score(game);
+	snapshot->hits = sim->hits;
+	snapshot->points = sim->points;
+	snapshot->inputs = sim->stepped_inputs;
+	snapshot->hit_position = sim->hit_position;
+	snapshot->time = SDL_GetPerformanceCounter();
+	sim->back = SDL_AtomicSet(&sim->latest, sim->back | SIM_FRESH) & ~SIM_FRESH;
+}
+
+
+// Simulation thread, steps in real time until stopped //
+static int run(void *data) {
+
+	Simulation *sim = data;
+	const Uint64 frequency = SDL_GetPerformanceFrequency();
+	const double tick = 1.0 / sim->tick_rate;
+	Uint64 last = SDL_GetPerformanceCounter();
+	double accumulator = 0;
+	while (!SDL_AtomicGet(&sim->quit)) {
+		const Uint64 now = SDL_GetPerformanceCounter();
+		if (sim->running && !sim->game->over) {
+			accumulator += (double)(now - last) / frequency;
+			if (accumulator > SIM_MAX_LAG) accumulator = SIM_MAX_LAG;
+		}
+		last = now;
+
+		// fixed steps, leftover time carries to the next pass //
+		bool changed = false;
+		for (;;) {
+			// the steps still owed cover the last accumulator seconds, input applies from the step nearest to it //
+			const bool stepping = sim->running && !sim->game->over;
+			if (!stepping) accumulator = 0;
+			const Uint64 start = now - (Uint64)(accumulator * frequency);
+			if (drain(sim, stepping ? start + (Uint64)(tick * frequency / 2) : SDL_MAX_UINT64)) {
+				changed = true;
+				continue;
+			}
+			if (!stepping || accumulator < tick) break;
+			sim->stepped_inputs = sim->inputs;
+			const Uint32 events = Game_Step(sim->game, tick);
+			if (events & GAME_EVENT_POINTS) ++sim->points;
+			if (events & GAME_EVENT_HIT) {
+				++sim->hits;
+				sim->hit_position = sim->game->ship_position;
+			}
+			accumulator -= tick;
+			++sim->tick;
+			changed = true;
+		}
+		if (changed) publish(sim);
+
+		// sleep to the next step, input waits at most this long //
+		const double remaining = sim->running ? tick - accumulator : tick;
+		SDL_Delay(remaining > 0.001 ? (Uint32)(remaining * 1000) : 1);
+	}
+	return 0;
+}
+
+
+// Create simulation and start its thread, it takes over game and recording until stopped //
+Simulation *Simulation_Create(Game *game, Uint32 tick_rate, Uint32 tick, Replay *recording) {
+
+	Simulation *sim = SDL_malloc(sizeof(Simulation));
+	if (!sim) {
+		SDL_SetError("Failed to allocate memory for simulation.");
+		return NULL;
+	}
+	const size_t capacity = game->rocks->entities.capacity ? game->rocks->entities.capacity : 1;
+	*sim = (Simulation) {
+		.game = game,
+		.recording = recording,
+		.tick = tick,
+		.tick_rate = tick_rate,
+		.back = 0,
+		.front = 2,
+		.block = SDL_SIMDAlloc(capacity * SIM_SNAPSHOTS * 4 * sizeof(float))
+	};
+	if (!sim->block) {
+		SDL_free(sim);
+		SDL_SetError("Failed to allocate memory for snapshots.");
+		return NULL;
+	}
+	for (int i = 0; i < SIM_SNAPSHOTS; ++i) {
+		float *arrays = sim->block + capacity * 4 * i;
+		sim->snapshots[i] = (Snapshot) {
+			.rock_x = arrays,
+			.rock_y = arrays + capacity,
+			.rock_prev_y = arrays + capacity * 2,
+			.rock_size = arrays + capacity * 3
+		};
+	}
+	SDL_AtomicSet(&sim->latest, 1);
+	SDL_AtomicSet(&sim->head, 0);
+	SDL_AtomicSet(&sim->tail, 0);
+	SDL_AtomicSet(&sim->quit, 0);
+	publish(sim);
+	sim->thread = SDL_CreateThread(run, "simulation", sim);
+	if (!sim->thread) {
+		Simulation_Destroy(sim);
+		return NULL;
+	}
+	return sim;
+}
+
+
+// Stops the thread, game, tick and recording belong to the caller again //
+void Simulation_Stop(Simulation *sim) {
+
+	if (!sim->thread) return;
+	SDL_AtomicSet(&sim->quit, 1);
+	SDL_WaitThread(sim->thread, NULL);
+	sim->thread = NULL;
+}
+
+
+// Destroy simulation, stopping it first //
+void Simulation_Destroy(Simulation *sim) {
+	if (!sim) return;
+	Simulation_Stop(sim);
+	SDL_SIMDFree(sim->block);
+	SDL_free(sim);
+}
+
+
+// Adds a command to the ring, never blocks, false if the queue is full //
+static bool queue(Simulation *sim, Sim_Command command) {
+
+	const int index = SDL_AtomicGet(&sim->head);
+	if (index - SDL_AtomicGet(&sim->tail) >= SIM_QUEUE) {
+		SDL_SetError("Simulation command queue is full.");
+		return false;
+	}
+	sim->commands[index & (SIM_QUEUE - 1)] = command;
+	SDL_AtomicSet(&sim->head, index + 1);
+	return true;
+}
+
+
+// Queues a command for the simulation to apply now //
+bool Simulation_Send(Simulation *sim, Uint32 type, Sint32 direction, Uint64 seed) {
+	return queue(sim, (Sim_Command) {type, direction, seed, SDL_GetPerformanceCounter()});
+}
+
+
+// Queues a direction change that happened at time, it applies from the step nearest that time //
+bool Simulation_SendInput(Simulation *sim, Sint32 direction, Uint64 time) {
+	return queue(sim, (Sim_Command) {SIM_DIRECTION, direction, 0, time});
+}
+
+
+// Newest complete snapshot, valid until the next call //
+const Snapshot *Simulation_Latest(Simulation *sim) {
+
+	if (SDL_AtomicGet(&sim->latest) & SIM_FRESH) {
+		sim->front = SDL_AtomicSet(&sim->latest, sim->front) & ~SIM_FRESH;
+	}
+	return &sim->snapshots[sim->front];
+}
+
+
+// Adds the asteroids between the last two steps to a batch, alpha blends from the previous step //
+void Snapshot_Draw(const Snapshot *snapshot, Quad_Batch *batch, const SDL_FRect *uv, float alpha) {
+
+	const SDL_Color color = {255, 255, 255, 255};
+	for (Uint32 i = 0; i < snapshot->rock_count; ++i) {
+		int y = snapshot->rock_prev_y[i] + (snapshot->rock_y[i] - snapshot->rock_prev_y[i]) * alpha;
+		if (y + snapshot->rock_size[i] <= 0 || y >= HEIGHT) continue;
+		SDL_FRect rock = {
+			.x = (int)snapshot->rock_x[i],
+			.y = y,
+			.w = snapshot->rock_size[i],
+			.h = snapshot->rock_size[i]
+		};
+		Quad_Batch_AddTextured(batch, &rock, uv, color);
+	}
+}
@@ -0,0 +1,96 @@
+///////////////////////////|
+//|File: simulation.h
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+//----------------------------------------------------------------
+
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <stdbool.h>
+
+#include "game.h"
+#include "replay.h"
+#include "quad.h"
+
+#define SIM_QUEUE 256			// commands waiting for the simulation thread, power of two
+#define SIM_SNAPSHOTS 3			// one being written, one being read, one ready
+#define SIM_MAX_LAG 0.25		// most seconds of steps the thread catches up on after a stall
+
+// Commands from the main thread //
+#define SIM_DIRECTION 1			// set the ship direction
+#define SIM_RESET 2				// start a new game from seed, stepping waits for SIM_START
+#define SIM_START 3				// start stepping the current game
+
+// One command, applied before the next step //
+typedef struct {
+	Uint32 type;			// SIM_ command
+	Sint32 direction;		// SIM_DIRECTION
+	Uint64 seed;			// SIM_RESET
+	Uint64 time;			// performance counter when it happened, it applies from the step nearest that time
+} Sim_Command;
+
+// Game state after one step, never changed once published //
+typedef struct {
+	Uint32 game;				// resets so far, older snapshots belong to an earlier game
+	Uint64 time;				// performance counter when the step finished
+	bool running;				// the game is being stepped
+	bool over;					// the ship has been hit
+	float ship_position;
+	float prev_ship_position;
+	Uint64 score;
+	Uint32 hits;				// hits so far this session
+	Uint32 points;				// points events so far this session
+	Uint32 inputs;				// direction changes applied before this step
+	float hit_position;			// ship position at the last hit
+	Uint32 rock_count;			// asteroids copied below, only the ones on screen
+	float *rock_x, *rock_y;
+	float *rock_prev_y;
+	float *rock_size;
+} Snapshot;
+
+// Steps a game at a fixed rate on its own thread //
+typedef struct {
+	Game *game;					// only touched by the thread while it runs
+	Replay *recording;			// input is recorded as it is applied, NULL when not recording
+	Uint32 tick;				// steps simulated since the session started
+	Uint32 tick_rate;
+	bool running;
+	Uint32 games, hits, points;
+	Uint32 inputs;				// direction changes applied
+	Uint32 stepped_inputs;		// direction changes the latest step had applied
+	float hit_position;
+	SDL_Thread *thread;
+	SDL_atomic_t quit;
+
+	// command ring, the main thread writes head and the simulation writes tail //
+	Sim_Command commands[SIM_QUEUE];
+	SDL_atomic_t head, tail;
+
+	// triple buffer, latest holds the index of the newest snapshot and SIM_FRESH if it is unread //
+	Snapshot snapshots[SIM_SNAPSHOTS];
+	SDL_atomic_t latest;
+	int back;					// written by the simulation
+	int front;					// read by the main thread
+	float *block;				// rock arrays of every snapshot
+} Simulation;
+
+Simulation *Simulation_Create(Game *game, Uint32 tick_rate, Uint32 tick, Replay *recording);
+
+void Simulation_Stop(Simulation *sim);
+
+void Simulation_Destroy(Simulation *sim);
+
+bool Simulation_Send(Simulation *sim, Uint32 type, Sint32 direction, Uint64 seed);
+
+bool Simulation_SendInput(Simulation *sim, Sint32 direction, Uint64 time);
+
+const Snapshot *Simulation_Latest(Simulation *sim);
+
+void Snapshot_Draw(const Snapshot *snapshot, Quad_Batch *batch, const SDL_FRect *uv, float alpha);
+
+#endif
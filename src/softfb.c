@@ -0,0 +1,357 @@
+///////////////////////////|
+//|File: softfb.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Draws the playfield into one CPU buffer and uploads it as a single
+ * texture, for machines where SDL only has its software renderer. Sprites
+ * come from the atlas's own pixel copy. Fills, opaque copies and colour-keyed
+ * blits run a row at a time through AVX2, SSE2 or plain C kernels picked
+ * once at runtime. Scaled or tinted quads take a plain C path.
+ */
+
+//----------------------------------------------------------------
+
+// SDL2 //
+#include <SDL2/SDL.h>
+
+// Header Files //
+#include "atlas.h"
+#include "quad.h"
+#include "softfb.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+#define SOFTFB_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SOFTFB_AVX2
+#include <immintrin.h>
+#endif
+
+// Rows are padded to this many pixels so each one starts on a SIMD boundary //
+#define FRAME_ALIGN 8
+
+// Row kernels, count pixels from src or of color //
+typedef struct {
+	void (*fill)(Uint32 *dst, int count, Uint32 color);
+	void (*copy)(Uint32 *dst, const Uint32 *src, int count);
+	void (*keyed)(Uint32 *dst, const Uint32 *src, int count);	// skips pixels with zero alpha
+} Row_Kernels;
+
+static Row_Kernels kernels;
+
+
+// Plain C kernels, also finish the tails of the vector kernels //
+static void fill_scalar(Uint32 *dst, int count, Uint32 color) {
+	for (int i = 0; i < count; ++i) dst[i] = color;
+}
+
+
+static void copy_scalar(Uint32 *dst, const Uint32 *src, int count) {
+	SDL_memcpy(dst, src, count * sizeof(Uint32));
+}
+
+
+static void keyed_scalar(Uint32 *dst, const Uint32 *src, int count) {
+	for (int i = 0; i < count; ++i) {
+		if (src[i] >> 24) dst[i] = src[i];
+	}
+}
+
+
+#ifdef SOFTFB_SSE2
+// Four pixels per step //
+static void fill_sse2(Uint32 *dst, int count, Uint32 color) {
+
+	const __m128i value = _mm_set1_epi32(color);
+	int i = 0;
+	for (; i + 4 <= count; i += 4) _mm_storeu_si128((__m128i *)(dst + i), value);
+	fill_scalar(dst + i, count - i, color);
+}
+
+
+static void copy_sse2(Uint32 *dst, const Uint32 *src, int count) {
+
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m128i a = _mm_loadu_si128((const __m128i *)(src + i));
+		const __m128i b = _mm_loadu_si128((const __m128i *)(src + i + 4));
+		_mm_storeu_si128((__m128i *)(dst + i), a);
+		_mm_storeu_si128((__m128i *)(dst + i + 4), b);
+	}
+	copy_scalar(dst + i, src + i, count - i);
+}
+
+
+static void keyed_sse2(Uint32 *dst, const Uint32 *src, int count) {
+
+	const __m128i alpha = _mm_set1_epi32(0xFF000000);
+	const __m128i zero = _mm_setzero_si128();
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+		const __m128i d = _mm_loadu_si128((const __m128i *)(dst + i));
+		// lanes with zero alpha keep what is already in the frame //
+		const __m128i clear = _mm_cmpeq_epi32(_mm_and_si128(s, alpha), zero);
+		_mm_storeu_si128((__m128i *)(dst + i), _mm_or_si128(_mm_and_si128(clear, d), _mm_andnot_si128(clear, s)));
+	}
+	keyed_scalar(dst + i, src + i, count - i);
+}
+#endif
+
+
+#ifdef SOFTFB_AVX2
+// Eight pixels per step //
+__attribute__((target("avx2")))
+static void fill_avx2(Uint32 *dst, int count, Uint32 color) {
+
+	const __m256i value = _mm256_set1_epi32(color);
+	int i = 0;
+	for (; i + 8 <= count; i += 8) _mm256_storeu_si256((__m256i *)(dst + i), value);
+	_mm256_zeroupper();
+	fill_scalar(dst + i, count - i, color);
+}
+
+
+__attribute__((target("avx2")))
+static void copy_avx2(Uint32 *dst, const Uint32 *src, int count) {
+
+	int i = 0;
+	for (; i + 16 <= count; i += 16) {
+		const __m256i a = _mm256_loadu_si256((const __m256i *)(src + i));
+		const __m256i b = _mm256_loadu_si256((const __m256i *)(src + i + 8));
+		_mm256_storeu_si256((__m256i *)(dst + i), a);
+		_mm256_storeu_si256((__m256i *)(dst + i + 8), b);
+	}
+	_mm256_zeroupper();
+	copy_scalar(dst + i, src + i, count - i);
+}
+
+
+__attribute__((target("avx2")))
+static void keyed_avx2(Uint32 *dst, const Uint32 *src, int count) {
+
+	const __m256i alpha = _mm256_set1_epi32(0xFF000000);
+	const __m256i zero = _mm256_setzero_si256();
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m256i s = _mm256_loadu_si256((const __m256i *)(src + i));
+		const __m256i d = _mm256_loadu_si256((const __m256i *)(dst + i));
+		const __m256i clear = _mm256_cmpeq_epi32(_mm256_and_si256(s, alpha), zero);
+		_mm256_storeu_si256((__m256i *)(dst + i), _mm256_blendv_epi8(s, d, clear));
+	}
+	_mm256_zeroupper();
+	keyed_scalar(dst + i, src + i, count - i);
+}
+#endif
+
+
+// Picks the widest kernels this CPU supports //
+static Row_Kernels pick_kernels(void) {
+
+#ifdef SOFTFB_AVX2
+	if (SDL_HasAVX2()) return (Row_Kernels) {fill_avx2, copy_avx2, keyed_avx2};
+#endif
+#ifdef SOFTFB_SSE2
+	if (SDL_HasSSE2()) return (Row_Kernels) {fill_sse2, copy_sse2, keyed_sse2};
+#endif
+	return (Row_Kernels) {fill_scalar, copy_scalar, keyed_scalar};
+}
+
+
+// Create frame and its streaming texture, the atlas must keep its pixels //
+Soft_Frame *Soft_Frame_Create(SDL_Renderer *renderer, const Atlas *atlas, int width, int height) {
+
+	if (!atlas->pixels) {
+		SDL_SetError("The atlas has no pixel copy to draw from.");
+		return NULL;
+	}
+	if (!kernels.fill) kernels = pick_kernels();
+	Soft_Frame *frame = SDL_malloc(sizeof(Soft_Frame));
+	if (!frame) {
+		SDL_SetError("Failed to allocate memory for frame.");
+		return NULL;
+	}
+	const int pitch = (width + FRAME_ALIGN - 1) / FRAME_ALIGN * FRAME_ALIGN;
+	*frame = (Soft_Frame) {
+		.pixels = SDL_SIMDAlloc((size_t)pitch * height * sizeof(Uint32)),
+		.width = width,
+		.height = height,
+		.pitch = pitch,
+		.texture = SDL_CreateTexture(renderer, SOFTFB_FORMAT, SDL_TEXTUREACCESS_STREAMING, width, height),
+		.atlas = atlas
+	};
+	if (!frame->pixels || !frame->texture) {
+		if (!frame->pixels) SDL_SetError("Failed to allocate memory for a %dx%d frame.", width, height);
+		Soft_Frame_Destroy(frame);
+		return NULL;
+	}
+	SDL_SetTextureBlendMode(frame->texture, SDL_BLENDMODE_NONE);
+	SDL_memset(frame->pixels, 0, (size_t)pitch * height * sizeof(Uint32));
+	return frame;
+}
+
+
+// Destroy frame //
+void Soft_Frame_Destroy(Soft_Frame *frame) {
+	if (!frame) return;
+	if (frame->texture) SDL_DestroyTexture(frame->texture);
+	SDL_SIMDFree(frame->pixels);
+	SDL_free(frame);
+}
+
+
+// Clips dst to the frame and moves src along with it, false when nothing is left //
+static bool clip(const Soft_Frame *frame, SDL_Rect *src, SDL_Rect *dst) {
+
+	const SDL_Rect bounds = {0, 0, frame->width, frame->height};
+	SDL_Rect clipped;
+	if (!SDL_IntersectRect(dst, &bounds, &clipped)) return false;
+	if (src) {
+		src->x += clipped.x - dst->x;
+		src->y += clipped.y - dst->y;
+		src->w = clipped.w;
+		src->h = clipped.h;
+	}
+	*dst = clipped;
+	return true;
+}
+
+
+// Runs a source kernel over every row of a same size copy //
+static void copy_rows(Soft_Frame *frame, const SDL_Rect *src_rect, const SDL_Rect *dst_rect, void (*kernel)(Uint32 *, const Uint32 *, int)) {
+
+	SDL_Rect src = *src_rect, dst = *dst_rect;
+	if (!clip(frame, &src, &dst)) return;
+	const Atlas *atlas = frame->atlas;
+	for (int y = 0; y < dst.h; ++y) {
+		kernel(
+			frame->pixels + (dst.y + y) * frame->pitch + dst.x,
+			atlas->pixels + (src.y + y) * atlas->width + src.x,
+			dst.w
+		);
+	}
+}
+
+
+// Fills a rectangle with an opaque color //
+void Soft_Frame_Fill(Soft_Frame *frame, const SDL_Rect *dst_rect, Uint32 color) {
+
+	SDL_Rect dst = *dst_rect;
+	if (!clip(frame, NULL, &dst)) return;
+	for (int y = dst.y; y < dst.y + dst.h; ++y) kernels.fill(frame->pixels + y * frame->pitch + dst.x, dst.w, color);
+}
+
+
+// Copies an atlas region as is, for opaque images such as the background //
+void Soft_Frame_Copy(Soft_Frame *frame, const SDL_Rect *src, const SDL_Rect *dst) {
+	copy_rows(frame, src, dst, kernels.copy);
+}
+
+
+// Copies an atlas region skipping its transparent pixels, the colour key became zero alpha in the atlas //
+void Soft_Frame_Blit(Soft_Frame *frame, const SDL_Rect *src, const SDL_Rect *dst) {
+	copy_rows(frame, src, dst, kernels.keyed);
+}
+
+
+// Multiplies a texel by a vertex color //
+static Uint32 modulate(Uint32 texel, SDL_Color color) {
+	const Uint32 a = ((texel >> 24) * color.a + 127) / 255;
+	const Uint32 r = ((texel >> 16 & 0xFF) * color.r + 127) / 255;
+	const Uint32 g = ((texel >> 8 & 0xFF) * color.g + 127) / 255;
+	const Uint32 b = ((texel & 0xFF) * color.b + 127) / 255;
+	return a << 24 | r << 16 | g << 8 | b;
+}
+
+
+// Blends a color over a frame pixel by the color's alpha //
+static Uint32 blend(Uint32 dst, Uint32 src) {
+	const Uint32 a = src >> 24, keep = 255 - a;
+	const Uint32 r = ((src >> 16 & 0xFF) * a + (dst >> 16 & 0xFF) * keep + 127) / 255;
+	const Uint32 g = ((src >> 8 & 0xFF) * a + (dst >> 8 & 0xFF) * keep + 127) / 255;
+	const Uint32 b = ((src & 0xFF) * a + (dst & 0xFF) * keep + 127) / 255;
+	return 0xFF000000 | r << 16 | g << 8 | b;
+}
+
+
+// Scaled or tinted quad, nearest texel and blended //
+static void draw_scaled(Soft_Frame *frame, const SDL_Rect *src, const SDL_Rect *dst_rect, SDL_Color color) {
+
+	SDL_Rect dst = *dst_rect;
+	if (!clip(frame, NULL, &dst)) return;
+	const Atlas *atlas = frame->atlas;
+
+	// texel steps in 16.16 fixed point rounded up, so exact texel boundaries land where dividing puts them //
+	const Uint32 step_u = (((Uint32)src->w << 16) + dst_rect->w - 1) / dst_rect->w;
+	const Uint32 step_v = (((Uint32)src->h << 16) + dst_rect->h - 1) / dst_rect->h;
+	const Uint32 start_u = (dst.x - dst_rect->x) * step_u;
+	Uint32 v = (dst.y - dst_rect->y) * step_v;
+	const bool tinted = color.r != 255 || color.g != 255 || color.b != 255;
+	for (int y = dst.y; y < dst.y + dst.h; ++y, v += step_v) {
+		const Uint32 *row = atlas->pixels + (src->y + (v >> 16)) * atlas->width + src->x;
+		Uint32 *out = frame->pixels + y * frame->pitch;
+		Uint32 u = start_u;
+		for (int x = dst.x; x < dst.x + dst.w; ++x, u += step_u) {
+			Uint32 texel = row[u >> 16];
+			if (!(texel >> 24)) continue;
+			if (tinted) texel = modulate(texel, color);
+			else texel = (texel & 0x00FFFFFF) | (((texel >> 24) * color.a + 127) / 255) << 24;
+			out[x] = blend(out[x], texel);
+		}
+	}
+}
+
+
+// Pixel nearest a position, SDL rasterizes at pixel centers //
+static int nearest(float position) {
+	return SDL_floorf(position + 0.5f);
+}
+
+
+// Draws a batch built for the atlas texture, each quad takes the fastest kernel that fits it //
+void Soft_Frame_DrawBatch(Soft_Frame *frame, const Quad_Batch *batch) {
+
+	const Atlas *atlas = frame->atlas;
+	for (int i = 0; i < batch->count; ++i) {
+		const SDL_Vertex *corner = batch->vertices + i * 4;
+		const SDL_Color color = corner[0].color;
+		const int x = nearest(corner[0].position.x), y = nearest(corner[0].position.y);
+		SDL_Rect dst = {x, y, nearest(corner[2].position.x) - x, nearest(corner[2].position.y) - y};
+		if (dst.w <= 0 || dst.h <= 0) continue;
+		const int u = nearest(corner[0].tex_coord.x * atlas->width), v = nearest(corner[0].tex_coord.y * atlas->height);
+		const SDL_Rect src = {u, v, nearest(corner[2].tex_coord.x * atlas->width) - u, nearest(corner[2].tex_coord.y * atlas->height) - v};
+
+		const bool white = color.r == 255 && color.g == 255 && color.b == 255 && color.a == 255;
+		if (src.w <= 0 || src.h <= 0) {
+			// solid quads sample one texel, the atlas's white block //
+			const Uint32 texel = modulate(atlas->pixels[src.y * atlas->width + src.x], color);
+			if ((texel >> 24) == 255) {
+				Soft_Frame_Fill(frame, &dst, texel);
+			} else if (texel >> 24 && clip(frame, NULL, &dst)) {
+				for (int y = dst.y; y < dst.y + dst.h; ++y) {
+					Uint32 *out = frame->pixels + y * frame->pitch;
+					for (int x = dst.x; x < dst.x + dst.w; ++x) out[x] = blend(out[x], texel);
+				}
+			}
+		} else if (white && src.w == dst.w && src.h == dst.h) {
+			Soft_Frame_Blit(frame, &src, &dst);
+		} else {
+			draw_scaled(frame, &src, &dst, color);
+		}
+	}
+}
+
+
+// Uploads the frame and copies it over the whole render target //
+bool Soft_Frame_Present(Soft_Frame *frame, SDL_Renderer *renderer) {
+
+	if (SDL_UpdateTexture(frame->texture, NULL, frame->pixels, frame->pitch * sizeof(Uint32)) < 0) return false;
+	return SDL_RenderCopy(renderer, frame->texture, NULL, NULL) == 0;
+}
@@ -0,0 +1,45 @@
+///////////////////////////|
+//|File: softfb.h
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+//----------------------------------------------------------------
+
+#ifndef SOFTFB_H
+#define SOFTFB_H
+
+#include <stdbool.h>
+
+#include "atlas.h"
+#include "quad.h"
+
+// Frame pixels are ARGB8888 like the atlas, alpha is ignored on upload //
+#define SOFTFB_FORMAT SDL_PIXELFORMAT_ARGB8888
+
+// A frame composed on the CPU and uploaded once per present //
+typedef struct {
+	Uint32 *pixels;			// rows start on a SIMD boundary
+	int width, height;
+	int pitch;				// pixels per row
+	SDL_Texture *texture;	// streaming, the frame is copied into it on present
+	const Atlas *atlas;		// source of every sprite, needs its pixels kept
+} Soft_Frame;
+
+Soft_Frame *Soft_Frame_Create(SDL_Renderer *renderer, const Atlas *atlas, int width, int height);
+
+void Soft_Frame_Destroy(Soft_Frame *frame);
+
+void Soft_Frame_Fill(Soft_Frame *frame, const SDL_Rect *dst, Uint32 color);
+
+void Soft_Frame_Copy(Soft_Frame *frame, const SDL_Rect *src, const SDL_Rect *dst);
+
+void Soft_Frame_Blit(Soft_Frame *frame, const SDL_Rect *src, const SDL_Rect *dst);
+
+void Soft_Frame_DrawBatch(Soft_Frame *frame, const Quad_Batch *batch);
+
+bool Soft_Frame_Present(Soft_Frame *frame, SDL_Renderer *renderer);
+
+#endif
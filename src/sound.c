@@ -0,0 +1,242 @@
+///////////////////////////|
+//|File: sound.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Mixes sound effects in the audio callback with a fixed set of voices.
+ * The game queues play requests on a single producer, single consumer ring
+ * that the callback drains without locking. Each sound caps how many voices
+ * it uses, and a full mixer steals from the lowest priority, oldest voice.
+ */
+
+//----------------------------------------------------------------
+
+// Includes //
+#include <stdbool.h>
+
+// SDL2 //
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+
+// Header Files //
+#include "assets.h"
+#include "sound.h"
+
+// One playing sound, only touched by the audio thread //
+typedef struct {
+	Sound *sound;		// NULL when free
+	Uint32 position;	// next frame to mix
+	Uint32 started;		// start order, the smallest is the oldest
+} Voice;
+
+// A queued play request //
+typedef struct {
+	Sound *sound;
+	Uint64 time;		// performance counter when it was queued
+} Request;
+
+// Request ring, the game writes head and the audio thread writes tail //
+static Request requests[SOUND_QUEUE];
+static SDL_atomic_t head, tail;
+
+// Audio thread state //
+static Voice voices[SOUND_VOICES];
+static Uint32 started;
+static Uint64 max_latency;
+
+// Latency statistics, shared under the spin lock //
+static SDL_SpinLock stats_lock;
+static Sound_Stats stats;
+static double total_ms;
+
+
+// Ends a voice //
+static void stop(Voice *voice) {
+	SDL_AtomicAdd(&voice->sound->playing, -1);
+	voice->sound = NULL;
+}
+
+
+// Finds a voice for a sound, NULL when every voice outranks it //
+static Voice *pick_voice(const Sound *sound) {
+
+	Voice *idle = NULL, *oldest = NULL, *victim = NULL;
+	int same = 0;
+	for (int i = 0; i < SOUND_VOICES; ++i) {
+		Voice *voice = &voices[i];
+		if (!voice->sound) {
+			if (!idle) idle = voice;
+			continue;
+		}
+		if (voice->sound == sound) {
+			++same;
+			if (!oldest || voice->started < oldest->started) oldest = voice;
+		}
+		const int priority = voice->sound->priority;
+		if (
+			priority <= sound->priority &&
+			(!victim || priority < victim->sound->priority || (priority == victim->sound->priority && voice->started < victim->started))
+		) {
+			victim = voice;
+		}
+	}
+	if (same >= sound->max_voices) return oldest;
+	return idle ? idle : victim;
+}
+
+
+// Starts every queued request //
+static void start_requests(Uint64 now) {
+
+	const double ms = 1000.0 / SDL_GetPerformanceFrequency();
+	Uint32 played = 0, dropped = 0, stolen = 0;
+	double latency_total = 0, latency_max = 0;
+	int index = SDL_AtomicGet(&tail);
+	const int end = SDL_AtomicGet(&head);
+	for (; index != end; ++index) {
+		const Request *request = &requests[index & (SOUND_QUEUE - 1)];
+		Sound *sound = request->sound;
+		const Uint64 age = now > request->time ? now - request->time : 0;
+		Voice *voice = age <= max_latency ? pick_voice(sound) : NULL;
+		if (!voice) {
+			SDL_AtomicAdd(&sound->playing, -1);
+			++dropped;
+			continue;
+		}
+		if (voice->sound) {
+			stop(voice);
+			++stolen;
+		}
+		*voice = (Voice) {.sound = sound, .started = started++};
+		++played;
+		latency_total += age * ms;
+		if (age * ms > latency_max) latency_max = age * ms;
+	}
+	SDL_AtomicSet(&tail, index);
+
+	if (played + dropped == 0) return;
+	SDL_AtomicLock(&stats_lock);
+	stats.played += played;
+	stats.dropped += dropped;
+	stats.stolen += stolen;
+	total_ms += latency_total;
+	if (latency_max > stats.max_ms) stats.max_ms = latency_max;
+	SDL_AtomicUnlock(&stats_lock);
+}
+
+
+// Audio callback, adds the voices on top of what SDL_mixer produced //
+static void mix(void *userdata, Uint8 *stream, int length) {
+
+	(void)userdata;
+	start_requests(SDL_GetPerformanceCounter());
+	Sint16 *out = (Sint16 *)stream;
+	const Uint32 frames = length / (sizeof(Sint16) * AUDIO_CHANNELS);
+	for (int i = 0; i < SOUND_VOICES; ++i) {
+		Voice *voice = &voices[i];
+		if (!voice->sound) continue;
+		const Sound *sound = voice->sound;
+		const Sint16 *in = sound->samples + voice->position * AUDIO_CHANNELS;
+		const Uint32 count = sound->frames - voice->position < frames ? sound->frames - voice->position : frames;
+		const int volume = sound->chunk->volume;
+		for (Uint32 s = 0; s < count * AUDIO_CHANNELS; ++s) {
+			const int sample = out[s] + in[s] * volume / MIX_MAX_VOLUME;
+			out[s] = sample > SDL_MAX_SINT16 ? SDL_MAX_SINT16 : sample < SDL_MIN_SINT16 ? SDL_MIN_SINT16 : sample;
+		}
+		voice->position += count;
+		if (voice->position >= sound->frames) stop(voice);
+	}
+}
+
+
+// Opens the audio device in the mixer format with a buffer of the given frames //
+bool Sound_Open(int frequency, int buffer) {
+
+	// no format changes are allowed, so chunks are converted to exactly this when loaded //
+	if (Mix_OpenAudioDevice(frequency, AUDIO_FORMAT, AUDIO_CHANNELS, buffer, NULL, 0) < 0) return false;
+	SDL_memset(voices, 0, sizeof(voices));
+	SDL_AtomicSet(&head, 0);
+	SDL_AtomicSet(&tail, 0);
+	// requests are only drained once a callback, so a whole buffer of waiting is never too late //
+	max_latency = SDL_GetPerformanceFrequency() * ((Uint64)buffer * 1000 / frequency + SOUND_MAX_LATENCY_MS) / 1000;
+	stats = (Sound_Stats) {.buffer_ms = buffer * 1000.0 / frequency};
+	total_ms = 0;
+	Mix_SetPostMix(mix, NULL);
+	return true;
+}
+
+
+// Stops every voice and closes the device, sounds can be destroyed after this //
+void Sound_Close(void) {
+
+	Mix_SetPostMix(NULL, NULL);
+	for (int i = 0; i < SOUND_VOICES; ++i) {
+		if (voices[i].sound) stop(&voices[i]);
+	}
+	Mix_CloseAudio();
+}
+
+
+// Wraps a loaded chunk, takes ownership of it //
+Sound *Sound_Create(Mix_Chunk *chunk, int max_voices, int priority) {
+
+	Sound *sound = SDL_malloc(sizeof(Sound));
+	if (!sound) {
+		Mix_FreeChunk(chunk);
+		SDL_SetError("Failed to allocate memory for sound.");
+		return NULL;
+	}
+	*sound = (Sound) {
+		.chunk = chunk,
+		.samples = (const Sint16 *)chunk->abuf,
+		.frames = chunk->alen / (sizeof(Sint16) * AUDIO_CHANNELS),
+		.max_voices = max_voices < 1 ? 1 : max_voices,
+		.priority = priority
+	};
+	return sound;
+}
+
+
+// Destroy sound, it must not be playing //
+void Sound_Destroy(Sound *sound) {
+	if (!sound) return;
+	Mix_FreeChunk(sound->chunk);
+	SDL_free(sound);
+}
+
+
+// Queues a sound to start on the next audio callback, called from one thread only //
+void Sound_Play(Sound *sound) {
+
+	const int index = SDL_AtomicGet(&head);
+	if (index - SDL_AtomicGet(&tail) >= SOUND_QUEUE) {
+		SDL_AtomicLock(&stats_lock);
+		++stats.dropped;
+		SDL_AtomicUnlock(&stats_lock);
+		return;
+	}
+	SDL_AtomicAdd(&sound->playing, 1);
+	requests[index & (SOUND_QUEUE - 1)] = (Request) {sound, SDL_GetPerformanceCounter()};
+	SDL_AtomicSet(&head, index + 1);
+}
+
+
+// True while a sound is queued or playing //
+bool Sound_Playing(Sound *sound) {
+	return SDL_AtomicGet(&sound->playing) > 0;
+}
+
+
+// Copies the latency statistics //
+void Sound_GetStats(Sound_Stats *out) {
+
+	SDL_AtomicLock(&stats_lock);
+	*out = stats;
+	out->average_ms = stats.played ? total_ms / stats.played : 0;
+	SDL_AtomicUnlock(&stats_lock);
+}
@@ -0,0 +1,54 @@
+///////////////////////////|
+//|File: sound.h
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+//----------------------------------------------------------------
+
+#ifndef SOUND_H
+#define SOUND_H
+
+#include <stdbool.h>
+
+#define SOUND_VOICES 16				// sounds mixed at once across every effect
+#define SOUND_QUEUE 64				// play requests waiting for the audio thread, power of two
+#define SOUND_MAX_LATENCY_MS 50		// requests older than this past one buffer are dropped instead of played late
+
+// An effect, samples are already in the device format //
+typedef struct {
+	struct Mix_Chunk *chunk;	// owned, keeps the samples alive
+	const Sint16 *samples;		// interleaved AUDIO_CHANNELS samples per frame
+	Uint32 frames;
+	int max_voices;				// voices this sound may use, the oldest is restarted past it
+	int priority;				// a busy mixer steals voices from lower priorities
+	SDL_atomic_t playing;		// voices playing or queued to play
+} Sound;
+
+// Play latency, measured from Sound_Play to the samples being mixed //
+typedef struct {
+	Uint32 played;		// requests that got a voice
+	Uint32 dropped;		// requests that were too late or had no voice to take
+	Uint32 stolen;		// voices cut off for a newer request
+	double average_ms;	// queue latency over the played requests
+	double max_ms;
+	double buffer_ms;	// device buffer, added on top of the queue latency
+} Sound_Stats;
+
+bool Sound_Open(int frequency, int buffer);
+
+void Sound_Close(void);
+
+Sound *Sound_Create(struct Mix_Chunk *chunk, int max_voices, int priority);
+
+void Sound_Destroy(Sound *sound);
+
+void Sound_Play(Sound *sound);
+
+bool Sound_Playing(Sound *sound);
+
+void Sound_GetStats(Sound_Stats *stats);
+
+#endif
@@ -11,33 +11,69 @@
 #include <SDL.h>
 
 #include "tilesheet.h"
+#include "assets.h"
 
-// Takes an SDL Surface, and the width and height of each tile, and creates a tilesheet.
-TileSheet *TileSheet_createFromSurface(
+// Bakes every tile's opaque pixels into row masks, the color key and zero alpha are transparent.
+static SDL_bool bake_masks(TileSheet *tilesheet, SDL_Surface *surface) {
+	const int tiles = tilesheet->sheet_width * tilesheet->sheet_height;
+	if (tiles == 0) return SDL_TRUE;
+	if (tilesheet->tile_width > 64) {
+		SDL_SetError("Masks need tiles at most 64 pixels wide.");
+		return SDL_FALSE;
+	}
+	tilesheet->masks = SDL_calloc((size_t)tiles * tilesheet->tile_height, sizeof(Uint64));
+	SDL_Surface *pixels = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+	if (!tilesheet->masks || !pixels) {
+		SDL_FreeSurface(pixels);
+		SDL_SetError("Failed to allocate memory for tile masks.");
+		return SDL_FALSE;
+	}
+	
+	Uint32 key, key_rgb = 0;
+	const SDL_bool keyed = SDL_GetColorKey(surface, &key) == 0;
+	if (keyed) {
+		Uint8 r, g, b;
+		SDL_GetRGB(key, surface->format, &r, &g, &b);
+		key_rgb = (Uint32)r << 16 | (Uint32)g << 8 | b;
+	}
+	for (int tile = 0; tile < tiles; ++tile) {
+		div_t pos = div(tile, tilesheet->sheet_width);
+		Uint64 *rows = tilesheet->masks + tile * tilesheet->tile_height;
+		for (int y = 0; y < tilesheet->tile_height; ++y) {
+			const Uint32 *row = (const Uint32 *)((Uint8 *)pixels->pixels + (pos.quot * tilesheet->tile_height + y) * pixels->pitch);
+			row += pos.rem * tilesheet->tile_width;
+			for (int x = 0; x < tilesheet->tile_width; ++x) {
+				const SDL_bool clear = (row[x] >> 24) == 0 || (keyed && (row[x] & 0x00FFFFFF) == key_rgb);
+				if (!clear) rows[y] |= (Uint64)1 << x;
+			}
+		}
+	}
+	SDL_FreeSurface(pixels);
+	return SDL_TRUE;
+}
+
+// Builds the tilesheet around a texture region, and keeps or frees the surface as the flags ask.
+static TileSheet *create_tilesheet(
 	SDL_Surface *surface,
-	SDL_Renderer *renderer,
+	SDL_Texture *texture,
+	SDL_Rect region,
+	SDL_bool owns_texture,
 	int tile_width,
 	int tile_height,
 	int flags
 )
 {
-	if (!surface) return NULL;
-	
-	// 0x00FF00 will be used as a key for transparency.
-	SDL_SetColorKey(surface, SDL_TRUE, SDL_MapRGB(surface->format, 0, 255, 0));
-	
-	SDL_Texture *texture = SDL_CreateTextureFromSurface(renderer, surface);
-	if (!texture) return NULL;
-	
 	TileSheet *tilesheet = SDL_malloc(sizeof(TileSheet));
 	if (!tilesheet) {
-		SDL_DestroyTexture(texture);
+		if (owns_texture) SDL_DestroyTexture(texture);
 		if (flags & TILESHEET_FREESURFACE) SDL_FreeSurface(surface);
 		SDL_SetError("Failed to allocate memory for tilesheet.");
 		return NULL;
 	} else {
 		*tilesheet = (TileSheet) {
 			.texture = texture,
+			.region = region,
+			.owns_texture = owns_texture,
 			.tile_width = tile_width,
 			.tile_height = tile_height,
 			.sheet_width = surface->w / tile_width,
@@ -45,6 +81,12 @@ TileSheet *TileSheet_createFromSurface(
 			.free_surface = !!(flags & TILESHEET_FREESURFACE)
 		};
 		
+		if ((flags & TILESHEET_CREATEMASK) && !bake_masks(tilesheet, surface)) {
+			tilesheet->surface = (flags & TILESHEET_FREESURFACE) ? surface : NULL;
+			TileSheet_destroy(tilesheet);
+			return NULL;
+		}
+		
 		if (flags & TILESHEET_CREATESURFACE) {
 			tilesheet->surface = surface;
 		} else if (flags & TILESHEET_FREESURFACE) {
@@ -58,6 +100,55 @@ TileSheet *TileSheet_createFromSurface(
 	return tilesheet;
 }
 
+// Takes an SDL Surface, and the width and height of each tile, and creates a tilesheet.
+TileSheet *TileSheet_createFromSurface(
+	SDL_Surface *surface,
+	SDL_Renderer *renderer,
+	int tile_width,
+	int tile_height,
+	int flags
+)
+{
+	if (!surface) return NULL;
+	
+	// 0x00FF00 will be used as a key for transparency.
+	if (!(flags & TILESHEET_KEYED)) SDL_SetColorKey(surface, SDL_TRUE, SDL_MapRGB(surface->format, 0, 255, 0));
+	
+	SDL_Texture *texture = NULL;
+	if (renderer) {
+		texture = SDL_CreateTextureFromSurface(renderer, surface);
+		if (!texture) return NULL;
+	}
+	
+	const SDL_Rect region = {0, 0, surface->w, surface->h};
+	return create_tilesheet(surface, texture, region, SDL_TRUE, tile_width, tile_height, flags);
+}
+
+// Takes an SDL Surface, and the width and height of each tile, and creates a tilesheet in a region of an atlas.
+TileSheet *TileSheet_createFromSurfaceInAtlas(
+	SDL_Surface *surface,
+	Atlas *atlas,
+	int tile_width,
+	int tile_height,
+	int flags
+)
+{
+	if (!surface) return NULL;
+	
+	// 0x00FF00 will be used as a key for transparency, the atlas stores it as alpha.
+	if (!(flags & TILESHEET_KEYED)) SDL_SetColorKey(surface, SDL_TRUE, SDL_MapRGB(surface->format, 0, 255, 0));
+	
+	SDL_Rect region;
+	if (!Atlas_Add(atlas, surface, &region)) {
+		if (flags & TILESHEET_FREESURFACE) SDL_FreeSurface(surface);
+		return NULL;
+	}
+	
+	if (tile_width <= 0) tile_width = surface->w;
+	if (tile_height <= 0) tile_height = surface->h;
+	return create_tilesheet(surface, atlas->texture, region, SDL_FALSE, tile_width, tile_height, flags);
+}
+
 // Takes a Windows bitmap image from RWops, and the width and height of each tile, and creates a tilesheet.
 TileSheet *TileSheet_createFromRWops(
 	SDL_RWops *src,
@@ -81,16 +172,30 @@ TileSheet *TileSheet_create(
 	int flags
 )
 {
-	SDL_Surface *surface = SDL_LoadBMP(file_path);
+	SDL_Surface *surface = Assets_LoadBMP(file_path);
 	return TileSheet_createFromSurface(surface, renderer, tile_width, tile_height, flags | TILESHEET_FREESURFACE);
 }
 
+// Takes the file path of a Windows bitmap image, and the width and height of each tile, and creates a tilesheet in a region of an atlas.
+TileSheet *TileSheet_createInAtlas(
+	const char *file_path,
+	Atlas *atlas,
+	int tile_width,
+	int tile_height,
+	int flags
+)
+{
+	SDL_Surface *surface = Assets_LoadBMP(file_path);
+	return TileSheet_createFromSurfaceInAtlas(surface, atlas, tile_width, tile_height, flags | TILESHEET_FREESURFACE);
+}
+
 // Frees all the resources for a tilesheet.
 void TileSheet_destroy(TileSheet *tilesheet) {
 	if (!tilesheet) return;
 	if (tilesheet->free_surface) SDL_FreeSurface(tilesheet->surface);
 	
-	SDL_DestroyTexture(tilesheet->texture);
+	if (tilesheet->owns_texture && tilesheet->texture) SDL_DestroyTexture(tilesheet->texture);
+	SDL_free(tilesheet->masks);
 	SDL_free(tilesheet);
 }
 
@@ -102,8 +207,8 @@ SDL_Rect TileSheet_getTileRect(TileSheet *tilesheet, int index) {
 	} else {
 		div_t tile = div(index, tilesheet->sheet_width);
 		return (SDL_Rect) {
-			.x = tile.rem * tilesheet->tile_width,
-			.y = tile.quot * tilesheet->tile_height,
+			.x = tilesheet->region.x + tile.rem * tilesheet->tile_width,
+			.y = tilesheet->region.y + tile.quot * tilesheet->tile_height,
 			.w = tilesheet->tile_width,
 			.h = tilesheet->tile_height
 		};
@@ -118,8 +223,8 @@ Uint32 TileSheet_getPixel(TileSheet *tilesheet, int index, int x, int y) {
 	) return 0;
 
 	SDL_Rect tile_rect = TileSheet_getTileRect(tilesheet, index);
-	x += tile_rect.x;
-	y += tile_rect.y;
+	x += tile_rect.x - tilesheet->region.x;
+	y += tile_rect.y - tilesheet->region.y;
 	
 	int bpp = tilesheet->surface->format->BytesPerPixel;
 	Uint8 *p = (Uint8 *)tilesheet->surface->pixels + y * tilesheet->surface->pitch + x * bpp;
@@ -141,3 +246,14 @@ Uint32 TileSheet_getPixel(TileSheet *tilesheet, int index, int x, int y) {
 		return 0;
 	}
 }
+
+const Uint64 *TileSheet_getTileMask(TileSheet *tilesheet, int index) {
+	if (
+		!tilesheet ||
+		!tilesheet->masks ||
+		index < 0 ||
+		index >= tilesheet->sheet_width * tilesheet->sheet_height
+	) return NULL;
+	
+	return tilesheet->masks + index * tilesheet->tile_height;
+}
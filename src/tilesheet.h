@@ -9,6 +9,8 @@
 #ifndef MOONLANDER_TILESHEET_H
 #define MOONLANDER_TILESHEET_H
 
+#include "atlas.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -19,7 +21,9 @@ extern "C" {
 enum TileSheet_flags {
 	TILESHEET_CREATETEXTURE = 0, ///< Create a texture (default behavior)
 	TILESHEET_CREATESURFACE = 1, ///< Create a surface (creates an extra copy in system memory)
-	TILESHEET_FREESURFACE = 2 ///< Free surface after it is no longer needed.
+	TILESHEET_FREESURFACE = 2, ///< Free surface after it is no longer needed.
+	TILESHEET_CREATEMASK = 4, ///< Bake a 1-bit mask of each tile's opaque pixels (tiles up to 64 pixels wide)
+	TILESHEET_KEYED = 8 ///< The surface's color key is already baked into its alpha, so no key is set
 };
 
 /**
@@ -28,18 +32,21 @@ enum TileSheet_flags {
 typedef struct {
 	SDL_Surface *surface; ///< surface containing tile data
 	SDL_Texture *texture; ///< texture containing tile data
+	SDL_Rect region; ///< area of the texture containing the tiles
+	SDL_bool owns_texture; ///< Whether the texture is destroyed with the tilesheet (false when it belongs to an atlas)
 	int tile_width; ///< width of a single tile
 	int tile_height; ///< height of a single tile
 	int sheet_width; ///< width of the tilesheet (in tiles)
 	int sheet_height; ///< height of the tilesheet (in tiles)
 	SDL_bool free_surface; ///< Whether to free the surface once it is no longer needed.
+	Uint64 *masks; ///< tile_height rows per tile, bit x set where pixel x is opaque (only with TILESHEET_CREATEMASK)
 } TileSheet;
 
 /**
  * @brief Takes an SDL Surface, and the width and height of each tile, and creates a tilesheet.
  * 
  * @param surface The surface to use
- * @param renderer The renderer the tilesheet will render to
+ * @param renderer The renderer the tilesheet will render to, or NULL for a tilesheet without a texture (e.g. only masks)
  * @param tile_width The width of a single tile
  * @param tile_height The height of a single tile
  * @param flags Flags for creating a tilesheet.
@@ -53,6 +60,26 @@ TileSheet *TileSheet_createFromSurface(
 	int flags
 );
 
+/**
+ * @brief Takes an SDL Surface, and the width and height of each tile, and creates a tilesheet in a region of an atlas.
+ * @details The tilesheet borrows the atlas texture, so tilesheets from the same atlas can be drawn without texture switches.
+ * A tile width or height of 0 uses the whole surface as one tile.
+ * 
+ * @param surface The surface to use
+ * @param atlas The atlas to copy the surface into
+ * @param tile_width The width of a single tile
+ * @param tile_height The height of a single tile
+ * @param flags Flags for creating a tilesheet.
+ * @return The newly created tilesheet
+ */
+TileSheet *TileSheet_createFromSurfaceInAtlas(
+	SDL_Surface *surface,
+	Atlas *atlas,
+	int tile_width,
+	int tile_height,
+	int flags
+);
+
 /**
  * @brief Takes a Windows bitmap image from RWops, and the width and height of each tile, and creates a tilesheet.
  * @details This does not set the position to 0 beforehand, nor set the position back to its initial value once the operation is complete.
@@ -76,9 +103,10 @@ TileSheet *TileSheet_createFromRWops(
 
 /**
  * @brief Takes the file path of a Windows bitmap image, and the width and height of each tile, and creates a tilesheet.
+ * @details The image comes from the asset archive when one is open and contains the path.
  * 
  * @param file_path The path to the file containing the tilesheet
- * @param renderer The renderer the tilesheet will render to
+ * @param renderer The renderer the tilesheet will render to, or NULL for a tilesheet without a texture (e.g. only masks)
  * @param tile_width The width of a single tile
  * @param tile_height The height of a single tile
  * @param flags Flags for creating a tilesheet.
@@ -92,9 +120,29 @@ TileSheet *TileSheet_create(
 	int flags
 );
 
+/**
+ * @brief Takes the file path of a Windows bitmap image, and the width and height of each tile, and creates a tilesheet in a region of an atlas.
+ * @details The image comes from the asset archive when one is open and contains the path.
+ * A tile width or height of 0 uses the whole image as one tile.
+ * 
+ * @param file_path The path to the file containing the tilesheet
+ * @param atlas The atlas to copy the image into
+ * @param tile_width The width of a single tile
+ * @param tile_height The height of a single tile
+ * @param flags Flags for creating a tilesheet.
+ * @return The newly created tilesheet
+ */
+TileSheet *TileSheet_createInAtlas(
+	const char *file_path,
+	Atlas *atlas,
+	int tile_width,
+	int tile_height,
+	int flags
+);
+
 /**
  * @brief Frees all the resources for a tilesheet.
- * @details This WILL NOT free the surface, since this is a borrowed resource.
+ * @details This WILL NOT free the surface, since this is a borrowed resource, nor the texture of an atlas.
  * 
  * @param tilesheet The tilesheet to free
  */
@@ -106,7 +154,7 @@ void TileSheet_destroy(TileSheet *tilesheet);
  * 
  * @param tilesheet The tilesheet to get the tile from
  * @param index The position of the tile on the tilesheet (left-to-right, top-to-bottom)
- * @return SDL_Rect containing the position and size of the tile
+ * @return SDL_Rect containing the position and size of the tile in the texture
  */
 SDL_Rect TileSheet_getTileRect(TileSheet *tilesheet, int index);
 
@@ -122,6 +170,16 @@ SDL_Rect TileSheet_getTileRect(TileSheet *tilesheet, int index);
  */
 Uint32 TileSheet_getPixel(TileSheet *tilesheet, int index, int x, int y);
 
+/**
+ * @brief Get the opaque pixel mask of a tile.
+ * @details This requires that you created the tilesheet with TILESHEET_CREATEMASK. The surface is not needed afterwards.
+ * 
+ * @param tilesheet The tilesheet to get the tile from
+ * @param index The position of the tile on the tilesheet (left-to-right, top-to-bottom)
+ * @return tile_height rows with bit x set where pixel x is opaque, or NULL if there is no mask
+ */
+const Uint64 *TileSheet_getTileMask(TileSheet *tilesheet, int index);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,156 @@
+///////////////////////////|
+//|File: pack.c
+//|Author: Jerrin C. Redmon
+//|Language: C
+//|Version: 1.0
+//|Date:October 17, 2026
+///////////////////////////|
+
+/*
+ * Description:
+ * Packs images and sounds into one asset archive for Space Dodge.
+ * Images are converted to the texture pixel format with their color key
+ * turned into alpha, and sounds to the mixer format here, so the game can
+ * use the data without decoding or converting it.
+ *
+ * Usage: sdpack OUTPUT FILE...
+ */
+
+//----------------------------------------------------------------
+
+// Includes //
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+// SDL2 //
+#include <SDL2/SDL.h>
+
+// Header Files //
+#include "assets.h"
+
+
+// Pads the archive to the next data boundary //
+static long pad(FILE *out) {
+
+	long pos = ftell(out);
+	while (pos % ASSETS_ALIGN) {
+		fputc(0, out);
+		++pos;
+	}
+	return pos;
+}
+
+
+// Writes an image as tightly packed rows of ASSETS_PIXELFORMAT, the game's color key already transparent //
+static bool pack_image(FILE *out, const char *path, Asset_Entry *entry) {
+
+	SDL_Surface *loaded = SDL_LoadBMP(path);
+	if (!loaded) return false;
+	SDL_Surface *surface = SDL_ConvertSurfaceFormat(loaded, ASSETS_PIXELFORMAT, 0);
+	SDL_FreeSurface(loaded);
+	if (!surface) return false;
+	entry->type = ASSET_IMAGE;
+	entry->format = ASSETS_PIXELFORMAT;
+	entry->width = surface->w;
+	entry->height = surface->h;
+	entry->pitch = surface->w * 4;
+	entry->size = entry->pitch * entry->height;
+	for (int y = 0; y < surface->h; ++y) {
+		// 0x00FF00 is keyed out, so loading skips that pass //
+		Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+		for (int x = 0; x < surface->w; ++x) {
+			if ((row[x] & 0x00FFFFFF) == 0x00FF00) row[x] = 0;
+		}
+		fwrite(row, entry->pitch, 1, out);
+	}
+	SDL_FreeSurface(surface);
+	return true;
+}
+
+
+// Writes a sound converted to the mixer format //
+static bool pack_sound(FILE *out, const char *path, Asset_Entry *entry) {
+
+	SDL_AudioSpec spec;
+	Uint8 *samples;
+	Uint32 length;
+	if (!SDL_LoadWAV(path, &spec, &samples, &length)) return false;
+	SDL_AudioCVT cvt;
+	if (SDL_BuildAudioCVT(&cvt, spec.format, spec.channels, spec.freq, AUDIO_FORMAT, AUDIO_CHANNELS, AUDIO_FREQUENCY) < 0) {
+		SDL_FreeWAV(samples);
+		return false;
+	}
+	cvt.len = length;
+	cvt.buf = SDL_malloc(length * cvt.len_mult);
+	if (!cvt.buf) {
+		SDL_FreeWAV(samples);
+		return false;
+	}
+	SDL_memcpy(cvt.buf, samples, length);
+	SDL_FreeWAV(samples);
+	if (SDL_ConvertAudio(&cvt) < 0) {
+		SDL_free(cvt.buf);
+		return false;
+	}
+	entry->type = ASSET_SOUND;
+	entry->format = AUDIO_FORMAT;
+	entry->frequency = AUDIO_FREQUENCY;
+	entry->channels = AUDIO_CHANNELS;
+	entry->size = cvt.len_cvt;
+	fwrite(cvt.buf, cvt.len_cvt, 1, out);
+	SDL_free(cvt.buf);
+	return true;
+}
+
+
+// Main //
+int main(int argc, char *argv[]) {
+
+	if (argc < 3) {
+		fprintf(stderr, "usage: %s OUTPUT FILE...\n", argv[0]);
+		return 1;
+	}
+	const Uint32 count = argc - 2;
+	Asset_Entry *entries = calloc(count, sizeof(Asset_Entry));
+	FILE *out = fopen(argv[1], "wb");
+	if (!entries || !out) {
+		fprintf(stderr, "Could not create %s\n", argv[1]);
+		return 1;
+	}
+
+	// header and table are written again once the offsets are known //
+	Assets_Header header = {.version = ASSETS_VERSION, .count = count};
+	memcpy(header.magic, ASSETS_MAGIC, 4);
+	fwrite(&header, sizeof(header), 1, out);
+	fwrite(entries, sizeof(Asset_Entry), count, out);
+
+	for (Uint32 i = 0; i < count; ++i) {
+		const char *path = argv[i + 2];
+		Asset_Entry *entry = &entries[i];
+		if (strlen(path) >= ASSET_NAME_MAX) {
+			fprintf(stderr, "%s: name longer than %d characters\n", path, ASSET_NAME_MAX - 1);
+			return 1;
+		}
+		strcpy(entry->name, path);
+		entry->offset = pad(out);
+		const char *ext = strrchr(path, '.');
+		bool packed = ext && strcmp(ext, ".wav") == 0 ? pack_sound(out, path, entry) : pack_image(out, path, entry);
+		if (!packed) {
+			fprintf(stderr, "%s: %s\n", path, SDL_GetError());
+			return 1;
+		}
+		printf("%-*s %8u bytes\n", ASSET_NAME_MAX, path, entry->size);
+	}
+
+	rewind(out);
+	fwrite(&header, sizeof(header), 1, out);
+	fwrite(entries, sizeof(Asset_Entry), count, out);
+	if (fclose(out) != 0) {
+		fprintf(stderr, "Could not write %s\n", argv[1]);
+		return 1;
+	}
+	free(entries);
+	return 0;
+}